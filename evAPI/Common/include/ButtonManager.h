@@ -0,0 +1,209 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ButtonManager.h                                           */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Reads every button on both controllers once per cycle     */
+/*                  and finds which ones were pressed or released.            */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef BUTTONMANAGER_H
+#define BUTTONMANAGER_H
+
+#include <stdint.h>
+#include "evAPIBasicConfig.h"
+#include "evErrorTypes.h"
+#include "evNamespace.h"
+
+//Max amount of callbacks that can be subscribed to button changes
+#define BUTTON_MANAGER_MAX_SUBSCRIBERS 16
+
+//Amount of values in controllerButtons
+#define BUTTON_COUNT 12
+
+namespace evAPI
+{
+  /**
+   * @brief A function called when a button is pressed or released.
+   * @param type The controller the button is on.
+   * @param button The button that changed.
+   * @param status Pressed or Released.
+   * @param data The pointer given when the callback was subscribed.
+  */
+  typedef void (*buttonCallback)(vex::controllerType type, controllerButtons button, buttonStatus status,
+                                 void *data);
+
+  /**
+   * @brief Reads all 12 buttons of both controllers into a bitmask each time update() is called. Bit n of
+   *        a mask is the button with the value n in controllerButtons. The buttons that changed are found
+   *        by comparing the mask with the one from the last update, so every reader sees the same presses
+   *        no matter how many times they check.
+   *
+   *        update() should be called once per loop of the main thread, before anything reads the buttons.
+   *        Once startEvents() is called, the controller events also sample the buttons between updates,
+   *        so a press shorter than one loop is still seen by the next update.
+  */
+  class ButtonManager
+  {
+    private:
+      struct subscriber
+      {
+        buttonCallback callback;
+        void *data;
+        uint8_t controller;
+        uint16_t mask;
+
+        //Pressed or Released
+        buttonStatus status;
+
+        //True if the entry is in use
+        bool used;
+      };
+
+      //Buttons held down in the newest snapshot of each controller
+      uint16_t current[2] = {};
+
+      //Buttons held down in the snapshot before the newest one
+      uint16_t previous[2] = {};
+
+      subscriber subscribers[BUTTON_MANAGER_MAX_SUBSCRIBERS] = {};
+
+      //True if the buttons of a controller are replaced by replacementButtons
+      bool replaced[2] = {};
+
+      //Buttons used in place of the controller, such as while a recording is replayed
+      uint16_t replacementButtons[2] = {};
+
+      vex::mutex subscriberLock;
+
+      //Buttons seen held by the controller events since the last update
+      uint16_t eventButtons[2] = {};
+
+      //System time in usec of the first button event since the last update. 0 if there wasn't one
+      uint64_t eventTime[2] = {};
+
+      //System time in usec of the first button event used by the last update. 0 if there wasn't one
+      uint64_t usedEventTime[2] = {};
+
+      vex::mutex eventLock;
+
+      /**
+       * @brief Samples the buttons of a controller when it sends a button event.
+       * @param controller 0 for the primary controller, 1 for the secondary controller.
+      */
+      void sampleEvent(uint8_t controller);
+
+      friend void primaryButtonEvent();
+      friend void secondaryButtonEvent();
+
+      /**
+       * @brief Reads every button on a controller.
+       * @param controller The controller to read.
+       * @returns A mask of the buttons being held down. 0 if the controller isn't connected.
+      */
+      static uint16_t readButtons(vex::controller &controller);
+
+      /**
+       * @brief Calls the subscribers of the buttons that changed in the last update.
+       * @param controller 0 for the primary controller, 1 for the secondary controller.
+      */
+      void notify(uint8_t controller);
+
+    public:
+      /**
+       * @brief Takes a new snapshot of the buttons on both controllers, and calls the subscribers of any
+       *        that were pressed or released. The callbacks run in the thread that calls this.
+      */
+      void update();
+
+      /**
+       * @brief Watches every button on both controllers for press and release events. Each event
+       *        samples and timestamps the buttons right away, and the next update() uses them.
+      */
+      void startEvents();
+
+      /**
+       * @param type The controller to check.
+       * @returns The system time in usec of the first button event used by the last update. 0 if
+       *          the last update didn't use an event.
+      */
+      uint64_t getEventTime(vex::controllerType type);
+
+      /**
+       * @brief Uses a mask in place of the buttons of a controller in the next updates, so recorded
+       *        button presses reach the subscribers the same way real ones do.
+       * @param type The controller to replace.
+       * @param buttons A mask of the buttons being held down.
+      */
+      void replaceButtons(vex::controllerType type, uint16_t buttons);
+
+      /**
+       * @brief Goes back to reading the buttons of a controller after replaceButtons().
+       * @param type The controller to read.
+      */
+      void restoreButtons(vex::controllerType type);
+
+      /**
+       * @param type The controller to check.
+       * @returns A mask of the buttons being held down.
+      */
+      uint16_t getHeld(vex::controllerType type);
+
+      /**
+       * @param type The controller to check.
+       * @returns A mask of the buttons pressed since the last update.
+      */
+      uint16_t getPressed(vex::controllerType type);
+
+      /**
+       * @param type The controller to check.
+       * @returns A mask of the buttons released since the last update.
+      */
+      uint16_t getReleased(vex::controllerType type);
+
+      /**
+       * @param type The controller the button is on.
+       * @param button The button to check.
+       * @returns True if the button was pressed since the last update.
+      */
+      bool wasPressed(vex::controllerType type, controllerButtons button);
+
+      /**
+       * @brief Returns the state of a button in the last update.
+       * @param type The controller the button is on.
+       * @param button The button to check.
+       * @returns The status of the button.
+      */
+      buttonStatus getStatus(vex::controllerType type, controllerButtons button);
+
+      /**
+       * @brief Calls a function each time a button is pressed or released.
+       * @param type The controller the button is on.
+       * @param button The button to watch.
+       * @param status Pressed or Released.
+       * @param callback The function to call.
+       * @param data Optional. A pointer given to the callback.
+       * @returns An evErrorInt object containing the ID of the subscriber in "data", and any errors in
+       *          "evErrorData".
+       *          Errors: Invalid_Argument_Data: If the status isn't Pressed or Released, or there is no
+       *          callback.
+       *          Range_Limit_Reached: If there is no room for another subscriber.
+       *          No_Error: If the callback was added.
+      */
+      evErrorInt subscribe(vex::controllerType type, controllerButtons button, buttonStatus status,
+                           buttonCallback callback, void *data = nullptr);
+
+      /**
+       * @brief Stops calling a subscribed function.
+       * @param ID The ID of the subscriber.
+      */
+      void unsubscribe(int ID);
+  };
+
+  /**
+   * @brief The button manager used by all of evAPI.
+  */
+  extern ButtonManager buttonManager;
+} // namespace evAPI
+
+#endif // BUTTONMANAGER_H
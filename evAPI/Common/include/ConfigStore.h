@@ -0,0 +1,199 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ConfigStore.h                                             */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Registry of tuning constants that are loaded from a small */
+/*                  INI file on the brain's SD card.                          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef CONFIGSTORE_H
+#define CONFIGSTORE_H
+
+#include <sys/types.h>
+#include "evAPIBasicConfig.h"
+#include "evErrorTypes.h"
+
+#define CONFIG_MAX_ENTRIES 96
+#define CONFIG_KEY_LENGTH 31
+#define CONFIG_FILE_NAME_LENGTH 31
+#define CONFIG_MAX_FILE_SIZE 4096
+#define CONFIG_MAX_CALLBACKS 8
+
+namespace evAPI
+{
+  /**
+   * @brief The type a config value was written as in the file.
+  */
+  enum class configType
+  {
+    Number = 0,
+    Integer,
+    Boolean
+  };
+
+  /**
+   * @brief Stores tuning constants by name so they can be changed without rebuilding the program.
+   *        The file is read once into a fixed size table, so reading values never touches the SD card.
+   *
+   *        File format:
+   *        # Comment
+   *        [drivePID]
+   *        kp = 0.125
+   *        ki = 4
+   *
+   *        Keys inside a section are stored as "section.key", so the example above creates
+   *        "drivePID.kp" and "drivePID.ki".
+  */
+  class ConfigStore
+  {
+    private:
+      struct configEntry
+      {
+        char key[CONFIG_KEY_LENGTH+1];
+        double value;
+        configType type;
+      };
+
+      struct reloadCallback
+      {
+        void (*callback)(void *);
+        void *context;
+      };
+
+      //Every value in the registry
+      configEntry entries[CONFIG_MAX_ENTRIES];
+      uint entryCount = 0;
+
+      //Functions to run after the file is reloaded
+      reloadCallback callbacks[CONFIG_MAX_CALLBACKS];
+      uint callbackCount = 0;
+
+      //Name of the file on the SD card
+      char fileName[CONFIG_FILE_NAME_LENGTH+1] = "";
+
+      //True if the file was read successfully
+      bool loaded = false;
+
+      //Buffer the file is read into
+      char fileBuffer[CONFIG_MAX_FILE_SIZE+1];
+
+      /**
+       * @returns The index of the entry with the key. -1 if the key doesn't exist.
+      */
+      int findEntry(const char *key);
+
+      /**
+       * @brief Adds an entry to the registry, or updates it if it already exists.
+       * @returns The index of the entry. -1 if the registry is full or the key is invalid.
+      */
+      int storeEntry(const char *key, double value, configType type);
+
+      /**
+       * @brief Parses the contents of fileBuffer into the registry.
+      */
+      void parse(int32_t length);
+
+    public:
+      ConfigStore();
+
+      /**
+       * @brief Reads a config file from the SD card into the registry. Values already in the registry
+       *        that aren't in the file are kept.
+       * @param name The name of the file on the SD card.
+       * @returns An evError.
+       *          Invalid_Argument_Data: If the name is invalid or too long.
+       *          No_Device_Defined: If there is no SD card inserted.
+       *          Object_Does_Not_Exist: If the file couldn't be read.
+       *          Range_Limit_Reached: If the file is larger than CONFIG_MAX_FILE_SIZE. Nothing is loaded.
+       *          No_Error: If the file was loaded.
+      */
+      evError load(const char *name);
+
+      /**
+       * @brief Reads the last loaded file again, then runs all the reload callbacks.
+       * @returns An evError.
+       *          No_Data_Defined: If no file has been loaded yet.
+       *          Any error from load().
+      */
+      evError reload();
+
+      /**
+       * @brief Writes every value in the registry back to the loaded file.
+       * @returns An evError.
+       *          No_Data_Defined: If no file name has been set by load().
+       *          No_Device_Defined: If there is no SD card inserted.
+       *          Range_Limit_Reached: If the registry doesn't fit in the file buffer.
+       *          Unknown_Error: If the file couldn't be written.
+       *          No_Error: If the file was saved.
+      */
+      evError save();
+
+      /**
+       * @brief Adds a function that runs every time reload() succeeds.
+       * @param callback The function to run. The context pointer is passed into it.
+       * @param context A pointer passed into the callback.
+       * @returns An evError.
+       *          Invalid_Argument_Data: If the callback is null.
+       *          Range_Limit_Reached: If there is no room for more callbacks.
+       *          No_Error: If the callback was added.
+      */
+      evError addReloadCallback(void (*callback)(void *), void *context);
+
+      /**
+       * @brief Gets a number from the registry. If the key doesn't exist, it is added with the default
+       *        value so save() writes a complete file.
+       * @param key The name of the value.
+       * @param defaultValue The value to use if the key doesn't exist.
+       * @returns The stored value.
+      */
+      double getNumber(const char *key, double defaultValue);
+
+      /**
+       * @brief Gets an integer from the registry. If the key doesn't exist, it is added with the default
+       *        value so save() writes a complete file.
+       * @param key The name of the value.
+       * @param defaultValue The value to use if the key doesn't exist.
+       * @returns The stored value rounded to the nearest integer.
+      */
+      int getInt(const char *key, int defaultValue);
+
+      /**
+       * @brief Gets a boolean from the registry. If the key doesn't exist, it is added with the default
+       *        value so save() writes a complete file.
+       * @param key The name of the value.
+       * @param defaultValue The value to use if the key doesn't exist.
+       * @returns The stored value.
+      */
+      bool getBool(const char *key, bool defaultValue);
+
+      /**
+       * @brief Changes a value in the registry. The change isn't written to the SD card until save()
+       *        is called.
+       * @param key The name of the value.
+       * @param value The new value.
+       * @returns An evError.
+       *          Invalid_Argument_Data: If the key is invalid or too long.
+       *          Range_Limit_Reached: If the registry is full.
+       *          No_Error: If the value was set.
+      */
+      evError setNumber(const char *key, double value);
+
+      /**
+       * @returns True if the key exists in the registry.
+      */
+      bool hasKey(const char *key);
+
+      /**
+       * @returns The amount of values in the registry.
+      */
+      uint getEntryCount();
+
+      /**
+       * @returns True if the last call to load() or reload() read the file.
+      */
+      bool isLoaded();
+  };
+} // namespace evAPI
+
+#endif // CONFIGSTORE_H
@@ -0,0 +1,178 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       LoopProfiler.h                                            */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Measures how long a loop takes to run and how late it     */
+/*                  starts, using fixed size histograms.                      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef LOOPPROFILER_H
+#define LOOPPROFILER_H
+
+#include <stdint.h>
+#include <sys/types.h>
+#include "evAPIBasicConfig.h"
+
+//Max amount of profilers that are listed by printAll()
+#define LOOP_PROFILER_MAX_COUNT 16
+
+//Times below 2^LOOP_PROFILER_MIN_BITS usec are put into the first bin
+#define LOOP_PROFILER_MIN_BITS 4
+
+//Amount of powers of 2 the histogram covers above the first bin
+#define LOOP_PROFILER_OCTAVES 14
+
+//Each power of 2 is split into 2^LOOP_PROFILER_STEP_BITS bins
+#define LOOP_PROFILER_STEP_BITS 2
+#define LOOP_PROFILER_STEPS (1 << LOOP_PROFILER_STEP_BITS)
+
+#define LOOP_PROFILER_BIN_COUNT (1 + LOOP_PROFILER_OCTAVES * LOOP_PROFILER_STEPS)
+
+//A loop that starts more than this percent of its period late is counted as an overrun
+#define LOOP_PROFILER_OVERRUN_MARGIN 25
+
+namespace evAPI
+{
+  /**
+   * @brief The timings a LoopProfiler records.
+  */
+  enum class loopMetric
+  {
+    //Time between the start of each loop
+    Period = 0,
+
+    //Time from beginLoop() to endLoop()
+    Execution,
+
+    //Difference between the period and the target period
+    Jitter
+  };
+
+  /**
+   * @brief Records the period, execution time, and jitter of a loop. Each time is put into a histogram
+   *        with bins that grow with the time, so the memory used never changes and percentiles stay
+   *        within about 12% of the real value from 16 usec up to 262 msec.
+   *
+   *        Call beginLoop() at the top of each loop and endLoop() once the work is done. The values can
+   *        be read from other threads while the loop is running.
+  */
+  class LoopProfiler
+  {
+    private:
+      struct timeHistogram
+      {
+        uint32_t bins[LOOP_PROFILER_BIN_COUNT];
+
+        //Amount of times added
+        uint32_t count;
+
+        //Largest time added in usec
+        uint32_t max;
+
+        /**
+         * @brief Adds a time to the histogram.
+         * @param time The time in usec.
+        */
+        void add(uint32_t time);
+
+        /**
+         * @returns The time a percent of the samples are under in usec. 0 if there are no samples.
+        */
+        uint32_t percentile(double percent) const;
+      };
+
+      //Name shown when the profiler is printed
+      const char *name;
+
+      //Time each loop should take in msec. 0 if the loop doesn't run at a set rate.
+      uint targetPeriod;
+
+      timeHistogram histograms[3];
+
+      uint32_t overruns = 0;
+
+      //System time the last loop started in usec. 0 if there was no last loop.
+      uint64_t lastStartTime = 0;
+
+      //System time the current loop started in usec
+      uint64_t startTime = 0;
+
+      /**
+       * @brief Adds the profiler to the list used by printAll().
+      */
+      void addToList();
+
+    public:
+      /**
+       * @brief Creates a profiler for a loop.
+       * @param profilerName The name shown when the profiler is printed.
+       * @param period The time each loop should take in msec. Set to 0 if the loop doesn't run at a set
+       *        rate, which only records the execution time.
+      */
+      LoopProfiler(const char *profilerName, uint period);
+      LoopProfiler(const LoopProfiler &other);
+      ~LoopProfiler();
+
+      /**
+       * @brief Changes the time each loop should take, and clears the recorded times.
+       * @param period The time in msec. Set to 0 if the loop doesn't run at a set rate.
+      */
+      void setTargetPeriod(uint period);
+
+      /**
+       * @brief Marks the start of a loop.
+      */
+      void beginLoop();
+
+      /**
+       * @brief Marks the end of the work in a loop.
+      */
+      void endLoop();
+
+      /**
+       * @brief Marks that the loop has stopped, so the time until the next beginLoop() isn't counted as a
+       *        period. Call when a motion ends.
+      */
+      void stop();
+
+      /**
+       * @brief Clears all of the recorded times.
+      */
+      void reset();
+
+      /**
+       * @param metric The timing to read.
+       * @param percent The percent of loops, from 0 to 100.
+       * @returns The time that percent of the loops were under in msec.
+      */
+      double getPercentile(loopMetric metric, double percent);
+
+      /**
+       * @returns The longest recorded time of a metric in msec.
+      */
+      double getMax(loopMetric metric);
+
+      /**
+       * @returns The amount of loops that have been recorded.
+      */
+      uint32_t getLoopCount();
+
+      /**
+       * @returns The amount of loops that started too late.
+      */
+      uint32_t getOverruns();
+
+      /**
+       * @brief Prints the timings to the terminal.
+      */
+      void print();
+
+      /**
+       * @brief Prints the timings of every profiler to the terminal.
+      */
+      static void printAll();
+  };
+} // namespace evAPI
+
+#endif // LOOPPROFILER_H
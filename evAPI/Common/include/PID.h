@@ -9,6 +9,8 @@
 #ifndef PID_H
 #define PID_H
 
+#include "ConfigStore.h"
+
 namespace evAPI {
   class PID {
     public:
@@ -52,7 +54,7 @@ namespace evAPI {
       bool isSettled();
 
       /**
-       * @brief Resets the timeout for the PID
+       * @brief Resets the timeout for the PID. Also clears the settle time and overshoot of the last run
        * 
        */
       void resetTimeout();
@@ -64,6 +66,72 @@ namespace evAPI {
        * @return double Output powers of the PID
        */
       double compute(double error);
+
+      /**
+       * @brief Does all the PID math for a loop that doesn't run at a fixed period
+       * 
+       * @param error The new error for the PID function
+       * @param timeScale The time since the last compute, in the cycles the constants were tuned for. The
+       *                  derivative is divided by it and the integral is multiplied by it
+       * @return double Output powers of the PID
+       */
+      double compute(double error, double timeScale);
+
+      /**
+       * @brief Loads the constants from a config store. Keys are "name.kp", "name.ki", "name.kd",
+       *        "name.starti", "name.settleError", "name.settleTime" and "name.timeout". Missing keys
+       *        keep their current value.
+       * 
+       * @param config The config store to read from
+       * @param name The name of the PID in the config file
+       */
+      void loadConfig(ConfigStore &config, const char *name);
+
+      /**
+       * @return double The KP factor
+       */
+      double getKP();
+
+      /**
+       * @return double The KI factor
+       */
+      double getKI();
+
+      /**
+       * @return double The KD factor
+       */
+      double getKD();
+
+      /**
+       * @return double The error that is good enough
+       */
+      double getSettleError();
+
+      /**
+       * @return double The cycle count that it needs to be settled
+       */
+      double getSettleTime();
+
+      /**
+       * @return double The timeout cycle count before it gives up
+       */
+      double getTimeout();
+
+      /**
+       * @brief Returns how long the last run took to settle. This is the cycle where the error last
+       *        entered the settle range. If it never did, it is the amount of cycles the PID ran for
+       * 
+       * @return double The settle time in cycles
+       */
+      double getSettleCycles();
+
+      /**
+       * @brief Returns how far the error went past zero in the last run. If the run started with no
+       *        error, like with drift control, this is the largest error seen
+       * 
+       * @return double The overshoot in the units of the error
+       */
+      double getOvershoot();
     
     private:
       double KP = 0;
@@ -77,6 +145,9 @@ namespace evAPI {
       double previousError = 0;
       double cyclesSpentSettled = 0;
       double cyclesSpentRunning = 0;
+      double settleStartCycle = 0;  // Cycle where the error last entered the settle range
+      double maxOvershoot = 0;  // Largest error on the far side of zero
+      int startingErrorSign = 0;  // Sign of the error on the first cycle of the run
   };
 }
 
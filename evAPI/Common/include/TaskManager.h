@@ -0,0 +1,201 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       TaskManager.h                                             */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Registry of the evAPI threads. Sets their priorities for  */
+/*                  each part of a match and measures their CPU usage.        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef TASKMANAGER_H
+#define TASKMANAGER_H
+
+#include <sys/types.h>
+#include "evAPIBasicConfig.h"
+#include "evErrorTypes.h"
+#include "evNamespace.h"
+
+#define TASK_MAX_COUNT 16
+#define TASK_NAME_LENGTH 15
+
+//Time between checks of the robot mode in msec
+#define TASK_MONITOR_TIME 100
+
+//Time the CPU usage is averaged over in msec
+#define TASK_USAGE_WINDOW 1000
+
+namespace evAPI
+{
+  /**
+   * @brief What a task is used for. The priority of a task is set by its role.
+  */
+  enum class taskRole
+  {
+    Odometry = 0,
+    Motion,
+    Sensor,
+    Driver,
+    UI,
+    Logging
+  };
+
+  //Amount of values in taskRole
+  #define TASK_ROLE_COUNT 6
+
+  /**
+   * @brief Keeps track of every evAPI thread. When the robot switches between disabled, autonomous, and
+   *        driver control, each thread is given the priority set for its role in that mode, so control
+   *        loops always run before screen drawing.
+   *
+   *        Tasks can wrap each loop with beginWork() and endWork() to measure how much of the CPU
+   *        they use.
+  */
+  class TaskManager
+  {
+    private:
+      struct taskEntry
+      {
+        //Name shown in the usage report
+        char name[TASK_NAME_LENGTH+1];
+
+        taskRole role;
+
+        //Thread the priority is set on. Null if the task sets its own priority in beginWork().
+        vex::thread *thread;
+
+        //True if the entry is in use
+        bool used;
+
+        //Priority the task is running at. -1 if it hasn't been set yet.
+        int appliedPriority;
+
+        //System time the current work started in usec
+        uint64_t workStartTime;
+
+        //Time spent working in the current window in usec
+        uint64_t busyTime;
+
+        //Percent of the CPU used in the last window
+        double usage;
+      };
+
+      taskEntry tasks[TASK_MAX_COUNT] = {};
+
+      //Priority for each role in each robotMode
+      int rolePriorities[3][TASK_ROLE_COUNT];
+
+      //Robot mode the priorities are set for
+      robotMode currentMode = robotMode::disabled;
+
+      //System time the current usage window started in usec
+      uint64_t windowStartTime = 0;
+
+      vex::mutex taskLock;
+
+      vex::thread *monitorThread = nullptr;
+
+      /**
+       * @brief Finds a free entry and fills it in.
+       * @returns The ID of the entry. -1 if there is no room.
+      */
+      int storeTask(vex::thread *thread, taskRole role, const char *name);
+
+      /**
+       * @brief Sets the priority of every task with a thread to the priority for the current mode.
+      */
+      void applyPriorities();
+
+      /**
+       * @brief Finishes the current usage window and starts a new one.
+      */
+      void updateUsage();
+
+      /**
+       * @brief Checks the robot mode and updates the usage.
+       * @param taskManagerObject A pointer to a TaskManager object.
+       * @returns 0
+      */
+      friend int taskMonitorThread(void *taskManagerObject);
+
+    public:
+      TaskManager();
+
+      /**
+       * @brief Adds a thread to the manager. Its priority is set right away.
+       * @param thread The thread.
+       * @param role What the thread is used for.
+       * @param name A name for the thread. Can be a max of 15 characters.
+       * @returns The ID of the task. -1 if there is no room for more tasks.
+      */
+      int addTask(vex::thread *thread, taskRole role, const char *name);
+
+      /**
+       * @brief Adds the thread that calls this function to the manager. The thread sets its own priority
+       *        when it calls beginWork(). Used for threads that are detached.
+       * @param role What the thread is used for.
+       * @param name A name for the thread. Can be a max of 15 characters.
+       * @returns The ID of the task. -1 if there is no room for more tasks.
+      */
+      int addCurrentTask(taskRole role, const char *name);
+
+      /**
+       * @brief Removes a task from the manager. Call this before a thread exits.
+       * @param ID The ID of the task.
+      */
+      void removeTask(int ID);
+
+      /**
+       * @brief Marks the start of one loop of work. Also updates the priority of tasks added with
+       *        addCurrentTask().
+       * @param ID The ID of the task.
+      */
+      void beginWork(int ID);
+
+      /**
+       * @brief Marks the end of one loop of work.
+       * @param ID The ID of the task.
+      */
+      void endWork(int ID);
+
+      /**
+       * @brief Changes the priority a role uses in a robot mode.
+       * @param role The role.
+       * @param mode The robot mode.
+       * @param priority The priority, from 1 to 15.
+       * @returns An evError.
+       *          Invalid_Argument_Data: If the priority is out of range.
+       *          No_Error: If the priority was set.
+      */
+      evError setRolePriority(taskRole role, robotMode mode, int priority);
+
+      /**
+       * @returns The priority a role uses in the current robot mode.
+      */
+      int getRolePriority(taskRole role);
+
+      /**
+       * @returns The percent of the CPU a task used in the last second. -1 if the task doesn't exist.
+      */
+      double getUsage(int ID);
+
+      /**
+       * @brief Prints the priority and CPU usage of every task to the terminal.
+      */
+      void printUsage();
+
+      /**
+       * @brief Starts the thread that checks the robot mode and calculates the CPU usage.
+       * @returns An evError.
+       *          Data_Already_Exists: If the thread is already running.
+       *          No_Error: If the thread was started.
+      */
+      evError startMonitor();
+  };
+
+  /**
+   * @brief The task manager used by all of evAPI.
+  */
+  extern TaskManager taskManager;
+} // namespace evAPI
+
+#endif // TASKMANAGER_H
@@ -65,14 +65,27 @@ namespace evAPI {
     /**
      * @brief A mode that should only be used temporarily during a match. The side to side motion of the
      * primary stick controls the angle the robot faces. Requires an inertial sensor to be set up in
-     * odometry.
+     * odometry, and drives like Arcade without one.
     */
     ServoSteering = 3,
 
     /**
      * @brief The primary stick drive the robot forward and backward, with the other in charge of turning it.
     */
-    RCControl = 4
+    RCControl = 4,
+
+    /**
+     * @brief Arcade control that scales both sides down together when one would go over full power, so
+     * the robot still turns the same amount at full speed.
+    */
+    NormalizedArcade = 5,
+
+    /**
+     * @brief The sticks are set up like RCControl, but the turn stick sets how sharply the robot curves
+     * instead of how fast it spins, so the turn is the same at any speed. When the drive stick is near
+     * the center the robot turns in place.
+    */
+    Curvature = 6
   };
 
   enum joystickType
@@ -105,6 +118,46 @@ namespace evAPI {
     Hold_Release
   };
 
+  enum class pidType //Used to select one of the PIDs in a drive base
+  {
+    Drive = 0,
+    Turn,
+    Drift,
+    Arc,
+    ArcDrift,
+    VisionTurn,
+    VisionDrive
+  };
+
+  enum class motionFault //Problems found while the drive base is moving
+  {
+    None = 0,
+    Slip,  //The wheels are spinning faster than the robot is moving
+    Stall,  //The motors are powered but not turning
+    Collision  //The robot hit something
+  };
+
+  enum class faultResponse //What a drive function does when it finds a motionFault
+  {
+    Ignore = 0,
+    Abort,  //End the drive function
+    ReducePower  //Finish the drive function at lower power
+  };
+
+  enum class steeringMode //How the stick sets the target heading in ServoSteering
+  {
+    Rate = 0,  //The stick turns the target heading, which is held when the stick is released
+    Absolute,  //The stick sets the target heading from where the robot faced when the mode started
+    FieldCentric  //The primary stick points the way to drive, with heading 0 pointing away from the driver
+  };
+
+  enum class visionSelection //How a VisionTracker picks one object out of a frame
+  {
+    Largest = 0,  //The object with the biggest area
+    Nearest,  //The object lowest in the image, which is the closest one on the floor
+    MostCentered  //The object closest to the middle of the image from side to side
+  };
+
   enum leftAndRight //Used for turning functions
   {
     LEFT = 0,
@@ -96,7 +96,7 @@ namespace evAPI
   vex::controller& typeToController(vex::controllerType type);
 
   /**
-   * @brief Returns the state of a button on a controller.
+   * @brief Returns the state of a button on a controller in the last buttonManager.update().
    * @param type The controller the desired button is on.
    * @param targetButton The button to check.
    * @returns The status of the button.
@@ -0,0 +1,266 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ButtonManager.cpp                                         */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Reads every button on both controllers once per cycle     */
+/*                  and finds which ones were pressed or released.            */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "../include/ButtonManager.h"
+#include "../include/generalFunctions.h"
+
+namespace evAPI
+{
+  ButtonManager buttonManager;
+
+  uint16_t ButtonManager::readButtons(vex::controller &controller)
+  {
+    if(!controller.installed())
+    {
+      return 0;
+    }
+
+    //*Buttons in the order of controllerButtons
+    vex::controller::button *buttons[BUTTON_COUNT] = {
+      &controller.ButtonL1, &controller.ButtonL2, &controller.ButtonR1, &controller.ButtonR2,
+      &controller.ButtonA, &controller.ButtonB, &controller.ButtonX, &controller.ButtonY,
+      &controller.ButtonUp, &controller.ButtonDown, &controller.ButtonLeft, &controller.ButtonRight
+    };
+
+    uint16_t mask = 0;
+
+    for(int i = 0; i < BUTTON_COUNT; i++)
+    {
+      if(buttons[i]->pressing())
+      {
+        mask |= 1 << i;
+      }
+    }
+
+    return mask;
+  }
+
+  void ButtonManager::update()
+  {
+    vex::controller *controllers[2] = {&primaryController, &secondaryController};
+
+    for(uint8_t i = 0; i < 2; i++)
+    {
+      //*Take the buttons sampled by the events since the last update
+      eventLock.lock();
+      uint16_t events = eventButtons[i];
+      usedEventTime[i] = eventTime[i];
+      eventButtons[i] = 0;
+      eventTime[i] = 0;
+      eventLock.unlock();
+
+      //*Buttons pressed and released between updates count as held for one update
+      previous[i] = current[i];
+      current[i] = replaced[i] ? replacementButtons[i] : readButtons(*controllers[i]) | (events & ~previous[i]);
+
+      //Only look for subscribers if something changed
+      if(current[i] != previous[i])
+      {
+        notify(i);
+      }
+    }
+  }
+
+  void ButtonManager::sampleEvent(uint8_t controller)
+  {
+    uint16_t buttons = readButtons(controller == 0 ? primaryController : secondaryController);
+    uint64_t currentTime = vex::timer::systemHighResolution();
+
+    eventLock.lock();
+    eventButtons[controller] |= buttons;
+
+    if(eventTime[controller] == 0)
+    {
+      eventTime[controller] = currentTime;
+    }
+
+    eventLock.unlock();
+  }
+
+  void primaryButtonEvent()
+  {
+    buttonManager.sampleEvent(0);
+  }
+
+  void secondaryButtonEvent()
+  {
+    buttonManager.sampleEvent(1);
+  }
+
+  void ButtonManager::startEvents()
+  {
+    vex::controller *controllers[2] = {&primaryController, &secondaryController};
+    void (*events[2])() = {primaryButtonEvent, secondaryButtonEvent};
+
+    for(uint8_t i = 0; i < 2; i++)
+    {
+      vex::controller &controller = *controllers[i];
+
+      //*Buttons in the order of controllerButtons
+      vex::controller::button *buttons[BUTTON_COUNT] = {
+        &controller.ButtonL1, &controller.ButtonL2, &controller.ButtonR1, &controller.ButtonR2,
+        &controller.ButtonA, &controller.ButtonB, &controller.ButtonX, &controller.ButtonY,
+        &controller.ButtonUp, &controller.ButtonDown, &controller.ButtonLeft, &controller.ButtonRight
+      };
+
+      for(int j = 0; j < BUTTON_COUNT; j++)
+      {
+        buttons[j]->pressed(events[i]);
+        buttons[j]->released(events[i]);
+      }
+    }
+  }
+
+  uint64_t ButtonManager::getEventTime(vex::controllerType type)
+  {
+    return usedEventTime[type == vex::controllerType::primary ? 0 : 1];
+  }
+
+  void ButtonManager::notify(uint8_t controller)
+  {
+    uint16_t changed = current[controller] ^ previous[controller];
+    vex::controllerType type = controller == 0 ? vex::controllerType::primary : vex::controllerType::partner;
+
+    for(int i = 0; i < BUTTON_MANAGER_MAX_SUBSCRIBERS; i++)
+    {
+      subscriber &entry = subscribers[i];
+
+      if(!entry.used || entry.controller != controller || !(changed & entry.mask))
+      {
+        continue;
+      }
+
+      //*Check if the button moved the way the subscriber wants
+      bool isHeld = current[controller] & entry.mask;
+
+      if(isHeld == (entry.status == buttonStatus::Pressed))
+      {
+        entry.callback(type, (controllerButtons)__builtin_ctz(entry.mask), entry.status, entry.data);
+      }
+    }
+  }
+
+  void ButtonManager::replaceButtons(vex::controllerType type, uint16_t buttons)
+  {
+    uint8_t controller = type == vex::controllerType::primary ? 0 : 1;
+    replacementButtons[controller] = buttons;
+    replaced[controller] = true;
+  }
+
+  void ButtonManager::restoreButtons(vex::controllerType type)
+  {
+    replaced[type == vex::controllerType::primary ? 0 : 1] = false;
+  }
+
+  uint16_t ButtonManager::getHeld(vex::controllerType type)
+  {
+    return current[type == vex::controllerType::primary ? 0 : 1];
+  }
+
+  uint16_t ButtonManager::getPressed(vex::controllerType type)
+  {
+    uint8_t controller = type == vex::controllerType::primary ? 0 : 1;
+    return current[controller] & ~previous[controller];
+  }
+
+  uint16_t ButtonManager::getReleased(vex::controllerType type)
+  {
+    uint8_t controller = type == vex::controllerType::primary ? 0 : 1;
+    return ~current[controller] & previous[controller];
+  }
+
+  bool ButtonManager::wasPressed(vex::controllerType type, controllerButtons button)
+  {
+    return getPressed(type) & (1 << (int)button);
+  }
+
+  buttonStatus ButtonManager::getStatus(vex::controllerType type, controllerButtons button)
+  {
+    uint8_t controller = type == vex::controllerType::primary ? 0 : 1;
+    uint16_t mask = 1 << (int)button;
+    bool isHeld = current[controller] & mask;
+    bool wasHeld = previous[controller] & mask;
+
+    //*Determine the state of the button
+    if(isHeld && wasHeld)
+    {
+      return buttonStatus::Hold_Press;
+    }
+
+    else if(isHeld)
+    {
+      return buttonStatus::Pressed;
+    }
+
+    else if(wasHeld)
+    {
+      return buttonStatus::Released;
+    }
+
+    return buttonStatus::Hold_Release;
+  }
+
+  evErrorInt ButtonManager::subscribe(vex::controllerType type, controllerButtons button, buttonStatus status,
+                                      buttonCallback callback, void *data)
+  {
+    evErrorInt returnData;
+    returnData.data = -1;
+
+    if(callback == nullptr || (status != buttonStatus::Pressed && status != buttonStatus::Released))
+    {
+      returnData.errorData = evError::Invalid_Argument_Data;
+      return returnData;
+    }
+
+    subscriberLock.lock();
+
+    //*Find a free entry
+    for(int i = 0; i < BUTTON_MANAGER_MAX_SUBSCRIBERS; i++)
+    {
+      if(!subscribers[i].used)
+      {
+        returnData.data = i;
+        break;
+      }
+    }
+
+    //*Fill in the entry
+    if(returnData.data != -1)
+    {
+      subscriber &entry = subscribers[returnData.data];
+      entry.callback = callback;
+      entry.data = data;
+      entry.controller = type == vex::controllerType::primary ? 0 : 1;
+      entry.mask = 1 << (int)button;
+      entry.status = status;
+      entry.used = true;
+    }
+
+    else
+    {
+      returnData.errorData = evError::Range_Limit_Reached;
+    }
+
+    subscriberLock.unlock();
+
+    return returnData;
+  }
+
+  void ButtonManager::unsubscribe(int ID)
+  {
+    if(ID < 0 || ID >= BUTTON_MANAGER_MAX_SUBSCRIBERS)
+    {
+      return;
+    }
+
+    subscriberLock.lock();
+    subscribers[ID].used = false;
+    subscriberLock.unlock();
+  }
+} // namespace evAPI
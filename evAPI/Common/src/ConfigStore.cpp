@@ -0,0 +1,422 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ConfigStore.cpp                                           */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Registry of tuning constants that are loaded from a small */
+/*                  INI file on the brain's SD card.                          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include "../include/ConfigStore.h"
+
+namespace evAPI
+{
+  /**
+   * @returns A pointer to the first character in the string that isn't a space or tab.
+  */
+  static char *skipWhitespace(char *text)
+  {
+    while(*text == ' ' || *text == '\t')
+    {
+      text++;
+    }
+
+    return text;
+  }
+
+  /**
+   * @brief Removes spaces, tabs, and carriage returns from the end of a string.
+  */
+  static void trimEnd(char *text)
+  {
+    size_t length = strlen(text);
+
+    while(length > 0 && (text[length-1] == ' ' || text[length-1] == '\t' || text[length-1] == '\r'))
+    {
+      text[--length] = '\0';
+    }
+  }
+
+  ConfigStore::ConfigStore()
+  {}
+
+  int ConfigStore::findEntry(const char *key)
+  {
+    for(uint i = 0; i < entryCount; i++)
+    {
+      if(strcmp(entries[i].key, key) == 0)
+      {
+        return i;
+      }
+    }
+
+    return -1;
+  }
+
+  int ConfigStore::storeEntry(const char *key, double value, configType type)
+  {
+    //Make sure the key will fit in the entry
+    if(key == nullptr || key[0] == '\0' || strlen(key) > CONFIG_KEY_LENGTH)
+    {
+      return -1;
+    }
+
+    int index = findEntry(key);
+
+    //*Add a new entry if the key doesn't exist
+    if(index == -1)
+    {
+      if(entryCount >= CONFIG_MAX_ENTRIES)
+      {
+        return -1;
+      }
+
+      index = entryCount;
+      strcpy(entries[index].key, key);
+      entryCount++;
+    }
+
+    entries[index].value = value;
+    entries[index].type = type;
+
+    return index;
+  }
+
+  void ConfigStore::parse(int32_t length)
+  {
+    //Section name that is added to the front of keys
+    char section[CONFIG_KEY_LENGTH+1] = "";
+
+    //Full key for the current line
+    char key[CONFIG_KEY_LENGTH+1];
+
+    fileBuffer[length] = '\0';
+    char *line = fileBuffer;
+
+    //*Read the file one line at a time
+    while(line != nullptr && *line != '\0')
+    {
+      //Split off the current line
+      char *nextLine = strchr(line, '\n');
+
+      if(nextLine != nullptr)
+      {
+        *nextLine = '\0';
+        nextLine++;
+      }
+
+      //Remove comments
+      char *comment = strpbrk(line, "#;");
+
+      if(comment != nullptr)
+      {
+        *comment = '\0';
+      }
+
+      line = skipWhitespace(line);
+      trimEnd(line);
+
+      //*Section header
+      if(line[0] == '[')
+      {
+        char *sectionEnd = strchr(line, ']');
+
+        if(sectionEnd != nullptr && (size_t)(sectionEnd - line - 1) <= CONFIG_KEY_LENGTH)
+        {
+          *sectionEnd = '\0';
+          strcpy(section, line + 1);
+        }
+      }
+
+      //*Key value pair
+      else if(line[0] != '\0')
+      {
+        char *separator = strchr(line, '=');
+
+        if(separator != nullptr)
+        {
+          *separator = '\0';
+          trimEnd(line);
+          char *valueText = skipWhitespace(separator + 1);
+
+          //Build the full key
+          int keyLength;
+
+          if(section[0] != '\0')
+          {
+            keyLength = snprintf(key, sizeof(key), "%s.%s", section, line);
+          }
+
+          else
+          {
+            keyLength = snprintf(key, sizeof(key), "%s", line);
+          }
+
+          //Skip keys that are too long to store
+          if(keyLength > 0 && keyLength <= CONFIG_KEY_LENGTH)
+          {
+            //Get the value and its type
+            if(strcmp(valueText, "true") == 0 || strcmp(valueText, "on") == 0)
+            {
+              storeEntry(key, 1, configType::Boolean);
+            }
+
+            else if(strcmp(valueText, "false") == 0 || strcmp(valueText, "off") == 0)
+            {
+              storeEntry(key, 0, configType::Boolean);
+            }
+
+            else
+            {
+              char *valueEnd;
+              double value = strtod(valueText, &valueEnd);
+
+              //Only store the value if the entire value was a number
+              if(valueEnd != valueText && *valueEnd == '\0')
+              {
+                if(strpbrk(valueText, ".eE") == nullptr)
+                {
+                  storeEntry(key, value, configType::Integer);
+                }
+
+                else
+                {
+                  storeEntry(key, value, configType::Number);
+                }
+              }
+            }
+          }
+        }
+      }
+
+      line = nextLine;
+    }
+  }
+
+  evError ConfigStore::load(const char *name)
+  {
+    //Make sure the name is valid
+    if(name == nullptr || name[0] == '\0' || strlen(name) > CONFIG_FILE_NAME_LENGTH)
+    {
+      return evError::Invalid_Argument_Data;
+    }
+
+    //Store the name so the file can be reloaded and saved
+    if(fileName != name)
+    {
+      strcpy(fileName, name);
+    }
+
+    loaded = false;
+
+    if(!Brain.SDcard.isInserted())
+    {
+      return evError::No_Device_Defined;
+    }
+
+    //*Read the entire file in one go. One extra byte is read to find files that don't fit.
+    int32_t length = Brain.SDcard.loadfile(fileName, (uint8_t *)fileBuffer, CONFIG_MAX_FILE_SIZE+1);
+
+    if(length <= 0)
+    {
+      return evError::Object_Does_Not_Exist;
+    }
+
+    //Don't use part of a file, since the last line could be cut off in the middle of a value
+    if(length > CONFIG_MAX_FILE_SIZE)
+    {
+      return evError::Range_Limit_Reached;
+    }
+
+    parse(length);
+    loaded = true;
+
+    return evError::No_Error;
+  }
+
+  evError ConfigStore::reload()
+  {
+    //Exit if there is no file to reload
+    if(fileName[0] == '\0')
+    {
+      return evError::No_Data_Defined;
+    }
+
+    evError loadError = load(fileName);
+
+    if(loadError != evError::No_Error)
+    {
+      return loadError;
+    }
+
+    //*Let everything using the config know the values changed
+    for(uint i = 0; i < callbackCount; i++)
+    {
+      callbacks[i].callback(callbacks[i].context);
+    }
+
+    return evError::No_Error;
+  }
+
+  evError ConfigStore::save()
+  {
+    //Exit if there is nowhere to save the file
+    if(fileName[0] == '\0')
+    {
+      return evError::No_Data_Defined;
+    }
+
+    if(!Brain.SDcard.isInserted())
+    {
+      return evError::No_Device_Defined;
+    }
+
+    //*Write every entry into the file buffer
+    int32_t length = 0;
+
+    for(uint i = 0; i < entryCount; i++)
+    {
+      int32_t remaining = CONFIG_MAX_FILE_SIZE - length;
+      int lineLength;
+
+      switch(entries[i].type)
+      {
+        case configType::Boolean:
+          lineLength = snprintf(fileBuffer + length, remaining, "%s = %s\n", entries[i].key, entries[i].value != 0 ? "true" : "false");
+          break;
+
+        case configType::Integer:
+          lineLength = snprintf(fileBuffer + length, remaining, "%s = %ld\n", entries[i].key, lround(entries[i].value));
+          break;
+
+        default:
+        case configType::Number:
+          lineLength = snprintf(fileBuffer + length, remaining, "%s = %.6g\n", entries[i].key, entries[i].value);
+
+          //Make sure the value is read back as a decimal number
+          if(lineLength > 0 && lineLength < remaining && strpbrk(fileBuffer + length + strlen(entries[i].key), ".eE") == nullptr)
+          {
+            lineLength = snprintf(fileBuffer + length, remaining, "%s = %.1f\n", entries[i].key, entries[i].value);
+          }
+          break;
+      }
+
+      //Exit if the file buffer is full
+      if(lineLength < 0 || lineLength >= remaining)
+      {
+        return evError::Range_Limit_Reached;
+      }
+
+      length += lineLength;
+    }
+
+    //*Write the file
+    if(Brain.SDcard.savefile(fileName, (uint8_t *)fileBuffer, length) != length)
+    {
+      return evError::Unknown_Error;
+    }
+
+    return evError::No_Error;
+  }
+
+  evError ConfigStore::addReloadCallback(void (*callback)(void *), void *context)
+  {
+    if(callback == nullptr)
+    {
+      return evError::Invalid_Argument_Data;
+    }
+
+    if(callbackCount >= CONFIG_MAX_CALLBACKS)
+    {
+      return evError::Range_Limit_Reached;
+    }
+
+    callbacks[callbackCount].callback = callback;
+    callbacks[callbackCount].context = context;
+    callbackCount++;
+
+    return evError::No_Error;
+  }
+
+  double ConfigStore::getNumber(const char *key, double defaultValue)
+  {
+    int index = findEntry(key);
+
+    //Add the default value if the key doesn't exist
+    if(index == -1)
+    {
+      storeEntry(key, defaultValue, configType::Number);
+      return defaultValue;
+    }
+
+    return entries[index].value;
+  }
+
+  int ConfigStore::getInt(const char *key, int defaultValue)
+  {
+    int index = findEntry(key);
+
+    //Add the default value if the key doesn't exist
+    if(index == -1)
+    {
+      storeEntry(key, defaultValue, configType::Integer);
+      return defaultValue;
+    }
+
+    return lround(entries[index].value);
+  }
+
+  bool ConfigStore::getBool(const char *key, bool defaultValue)
+  {
+    int index = findEntry(key);
+
+    //Add the default value if the key doesn't exist
+    if(index == -1)
+    {
+      storeEntry(key, defaultValue, configType::Boolean);
+      return defaultValue;
+    }
+
+    return entries[index].value != 0;
+  }
+
+  evError ConfigStore::setNumber(const char *key, double value)
+  {
+    if(key == nullptr || key[0] == '\0' || strlen(key) > CONFIG_KEY_LENGTH)
+    {
+      return evError::Invalid_Argument_Data;
+    }
+
+    //Keep the type of existing entries, unless an integer is given a decimal value
+    int index = findEntry(key);
+    configType type = (index == -1) ? configType::Number : entries[index].type;
+
+    if(type == configType::Integer && value != floor(value))
+    {
+      type = configType::Number;
+    }
+
+    if(storeEntry(key, value, type) == -1)
+    {
+      return evError::Range_Limit_Reached;
+    }
+
+    return evError::No_Error;
+  }
+
+  bool ConfigStore::hasKey(const char *key)
+  {
+    return findEntry(key) != -1;
+  }
+
+  uint ConfigStore::getEntryCount()
+  {
+    return entryCount;
+  }
+
+  bool ConfigStore::isLoaded()
+  {
+    return loaded;
+  }
+} // namespace evAPI
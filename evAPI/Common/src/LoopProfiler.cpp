@@ -0,0 +1,237 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       LoopProfiler.cpp                                          */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Measures how long a loop takes to run and how late it     */
+/*                  starts, using fixed size histograms.                      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "../include/LoopProfiler.h"
+
+namespace evAPI
+{
+  //Every profiler that exists, so they can all be printed
+  static LoopProfiler *profilerList[LOOP_PROFILER_MAX_COUNT];
+
+  //*Histogram
+
+  void LoopProfiler::timeHistogram::add(uint32_t time)
+  {
+    uint bin = 0;
+
+    //*Find the bin from the highest set bit and the bits below it
+    if(time >= (1u << LOOP_PROFILER_MIN_BITS))
+    {
+      uint exponent = 31 - __builtin_clz(time);
+      uint step = (time >> (exponent - LOOP_PROFILER_STEP_BITS)) & (LOOP_PROFILER_STEPS - 1);
+      bin = 1 + (exponent - LOOP_PROFILER_MIN_BITS) * LOOP_PROFILER_STEPS + step;
+
+      //Times that are too long go into the last bin
+      if(bin >= LOOP_PROFILER_BIN_COUNT)
+      {
+        bin = LOOP_PROFILER_BIN_COUNT - 1;
+      }
+    }
+
+    bins[bin]++;
+    count++;
+
+    if(time > max)
+    {
+      max = time;
+    }
+  }
+
+  uint32_t LoopProfiler::timeHistogram::percentile(double percent) const
+  {
+    if(count == 0)
+    {
+      return 0;
+    }
+
+    //*Find the bin the percentile is in
+    uint32_t target = (uint32_t)((percent / 100) * count);
+    uint32_t total = 0;
+    uint bin = 0;
+
+    for(; bin < LOOP_PROFILER_BIN_COUNT - 1; bin++)
+    {
+      total += bins[bin];
+
+      if(total > target)
+      {
+        break;
+      }
+    }
+
+    //*Use the middle of the bin
+    uint32_t time;
+
+    if(bin == 0)
+    {
+      time = (1u << LOOP_PROFILER_MIN_BITS) / 2;
+    }
+
+    else
+    {
+      uint exponent = (bin - 1) / LOOP_PROFILER_STEPS + LOOP_PROFILER_MIN_BITS;
+      uint step = (bin - 1) % LOOP_PROFILER_STEPS;
+      uint32_t lower = (LOOP_PROFILER_STEPS + step) << (exponent - LOOP_PROFILER_STEP_BITS);
+      time = lower + (1u << (exponent - LOOP_PROFILER_STEP_BITS)) / 2;
+    }
+
+    //The real time can't be longer than the longest time recorded
+    return time > max ? max : time;
+  }
+
+  //*Profiler
+
+  LoopProfiler::LoopProfiler(const char *profilerName, uint period)
+  {
+    name = profilerName;
+    targetPeriod = period;
+    reset();
+    addToList();
+  }
+
+  LoopProfiler::LoopProfiler(const LoopProfiler &other)
+  {
+    name = other.name;
+    targetPeriod = other.targetPeriod;
+    memcpy(histograms, other.histograms, sizeof(histograms));
+    overruns = other.overruns;
+    lastStartTime = other.lastStartTime;
+    startTime = other.startTime;
+
+    //Copies are listed separately
+    addToList();
+  }
+
+  void LoopProfiler::addToList()
+  {
+    for(int i = 0; i < LOOP_PROFILER_MAX_COUNT; i++)
+    {
+      if(profilerList[i] == nullptr)
+      {
+        profilerList[i] = this;
+        break;
+      }
+    }
+  }
+
+  LoopProfiler::~LoopProfiler()
+  {
+    for(int i = 0; i < LOOP_PROFILER_MAX_COUNT; i++)
+    {
+      if(profilerList[i] == this)
+      {
+        profilerList[i] = nullptr;
+      }
+    }
+  }
+
+  void LoopProfiler::setTargetPeriod(uint period)
+  {
+    targetPeriod = period;
+    reset();
+  }
+
+  void LoopProfiler::beginLoop()
+  {
+    startTime = vex::timer::systemHighResolution();
+
+    //*Record the period if the loop was already running
+    if(targetPeriod != 0 && lastStartTime != 0)
+    {
+      uint32_t period = startTime - lastStartTime;
+      uint32_t target = targetPeriod * 1000;
+      histograms[(int)loopMetric::Period].add(period);
+      histograms[(int)loopMetric::Jitter].add(period > target ? period - target : target - period);
+
+      if(period > target + (target * LOOP_PROFILER_OVERRUN_MARGIN) / 100)
+      {
+        overruns++;
+      }
+    }
+
+    lastStartTime = startTime;
+  }
+
+  void LoopProfiler::endLoop()
+  {
+    histograms[(int)loopMetric::Execution].add(vex::timer::systemHighResolution() - startTime);
+  }
+
+  void LoopProfiler::stop()
+  {
+    lastStartTime = 0;
+  }
+
+  void LoopProfiler::reset()
+  {
+    memset(histograms, 0, sizeof(histograms));
+    overruns = 0;
+    lastStartTime = 0;
+  }
+
+  double LoopProfiler::getPercentile(loopMetric metric, double percent)
+  {
+    return histograms[(int)metric].percentile(percent) / 1000.0;
+  }
+
+  double LoopProfiler::getMax(loopMetric metric)
+  {
+    return histograms[(int)metric].max / 1000.0;
+  }
+
+  uint32_t LoopProfiler::getLoopCount()
+  {
+    return histograms[(int)loopMetric::Execution].count;
+  }
+
+  uint32_t LoopProfiler::getOverruns()
+  {
+    return overruns;
+  }
+
+  void LoopProfiler::print()
+  {
+    printf("%s: %lu loops", name, (unsigned long)getLoopCount());
+
+    if(targetPeriod != 0)
+    {
+      printf(", target %u ms, %lu overruns", targetPeriod, (unsigned long)overruns);
+    }
+
+    printf("\n");
+    printf("  %-9s %7s %7s %7s %7s\n", "msec", "p50", "p90", "p99", "max");
+
+    static const char *metricNames[3] = {"period", "execution", "jitter"};
+
+    for(int i = 0; i < 3; i++)
+    {
+      //Loops without a set rate only have execution times
+      if(histograms[i].count == 0)
+      {
+        continue;
+      }
+
+      loopMetric metric = (loopMetric)i;
+      printf("  %-9s %7.2f %7.2f %7.2f %7.2f\n", metricNames[i], getPercentile(metric, 50),
+             getPercentile(metric, 90), getPercentile(metric, 99), getMax(metric));
+    }
+  }
+
+  void LoopProfiler::printAll()
+  {
+    for(int i = 0; i < LOOP_PROFILER_MAX_COUNT; i++)
+    {
+      if(profilerList[i] != nullptr)
+      {
+        profilerList[i]->print();
+      }
+    }
+  }
+} // namespace evAPI
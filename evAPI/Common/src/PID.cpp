@@ -74,11 +74,14 @@ namespace evAPI {
   }
 
   /**
-   * @brief Resets the timeout for the PID
+   * @brief Resets the timeout for the PID. Also clears the settle time and overshoot of the last run
    * 
    */
   void PID::resetTimeout() {
     cyclesSpentRunning = 0;
+    settleStartCycle = 0;
+    maxOvershoot = 0;
+    startingErrorSign = 0;
   }
 
   /**
@@ -88,11 +91,23 @@ namespace evAPI {
    * @return double Output powers of the PID
    */
   double PID::compute(double error){
+    return compute(error, 1);
+  }
+
+  /**
+   * @brief Does all the PID math for a loop that doesn't run at a fixed period
+   * 
+   * @param error The new error for the PID function
+   * @param timeScale The time since the last compute, in the cycles the constants were tuned for
+   * @return double Output powers of the PID
+   */
+  double PID::compute(double error, double timeScale){
     double output;
+    if(timeScale <= 0) timeScale = 1;
 
     //adds the error to the accumulator if it is large enough
     if(fabs(error) < starti) {
-      accumulatedError+=error;
+      accumulatedError+=error * timeScale;
     }
 
     //resets the accumulated error if the robot passes the wanted location
@@ -100,16 +115,85 @@ namespace evAPI {
       accumulatedError = 0; 
     }
 
-    output = KP * error + KI * accumulatedError + KD * (error-previousError);  //the core PID math
+    output = KP * error + KI * accumulatedError + KD * (error-previousError) / timeScale;  //the core PID math
     previousError=error;
 
     if(fabs(error) < settleError) {  //if the error is in the ok range
+      if(cyclesSpentSettled == 0) settleStartCycle = cyclesSpentRunning;  //record when it entered the range
       cyclesSpentSettled++;  //add 1 to the cycles that it has been
     } else {  //if it's not in the ok range
       cyclesSpentSettled = 0;  //reset the counter
     }
 
+    //record how far the error goes past zero
+    if(cyclesSpentRunning == 0) {
+      startingErrorSign = (error > 0) - (error < 0);
+    }
+    if(startingErrorSign == 0 || (error * startingErrorSign) < 0) {
+      if(fabs(error) > maxOvershoot) maxOvershoot = fabs(error);
+    }
+
     cyclesSpentRunning++;
     return output;
   }
+
+  /**
+   * @brief Loads the constants from a config store
+   * 
+   * @param config The config store to read from
+   * @param name The name of the PID in the config file
+   */
+  void PID::loadConfig(ConfigStore &config, const char *name) {
+    char key[CONFIG_KEY_LENGTH+1];
+
+    snprintf(key, sizeof(key), "%s.kp", name);
+    KP = config.getNumber(key, KP);
+    snprintf(key, sizeof(key), "%s.ki", name);
+    KI = config.getNumber(key, KI);
+    snprintf(key, sizeof(key), "%s.kd", name);
+    KD = config.getNumber(key, KD);
+    snprintf(key, sizeof(key), "%s.starti", name);
+    starti = config.getNumber(key, starti);
+    snprintf(key, sizeof(key), "%s.settleError", name);
+    settleError = config.getNumber(key, settleError);
+    snprintf(key, sizeof(key), "%s.settleTime", name);
+    settleTime = config.getNumber(key, settleTime);
+    snprintf(key, sizeof(key), "%s.timeout", name);
+    timeout = config.getNumber(key, timeout);
+  }
+
+  double PID::getKP() {
+    return KP;
+  }
+
+  double PID::getKI() {
+    return KI;
+  }
+
+  double PID::getKD() {
+    return KD;
+  }
+
+  double PID::getSettleError() {
+    return settleError;
+  }
+
+  double PID::getSettleTime() {
+    return settleTime;
+  }
+
+  double PID::getTimeout() {
+    return timeout;
+  }
+
+  double PID::getSettleCycles() {
+    if(cyclesSpentSettled == 0) {
+      return cyclesSpentRunning;
+    }
+    return settleStartCycle;
+  }
+
+  double PID::getOvershoot() {
+    return maxOvershoot;
+  }
 }
\ No newline at end of file
@@ -0,0 +1,282 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       TaskManager.cpp                                           */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Registry of the evAPI threads. Sets their priorities for  */
+/*                  each part of a match and measures their CPU usage.        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "../include/TaskManager.h"
+#include "../include/generalFunctions.h"
+
+namespace evAPI
+{
+  TaskManager taskManager;
+
+  //Names of each role for the usage report
+  static const char *roleNames[TASK_ROLE_COUNT] = {"Odometry", "Motion", "Sensor", "Driver", "UI", "Logging"};
+
+  int taskMonitorThread(void *taskManagerObject)
+  {
+    TaskManager *manager = (TaskManager*)taskManagerObject;
+
+    while(true)
+    {
+      //*Change the priorities when the robot mode changes
+      robotMode mode = getCompetitionStatus();
+
+      if(mode != manager->currentMode)
+      {
+        manager->currentMode = mode;
+        manager->applyPriorities();
+      }
+
+      //*Update the usage once each window
+      if(vex::timer::systemHighResolution() - manager->windowStartTime >= TASK_USAGE_WINDOW * 1000)
+      {
+        manager->updateUsage();
+      }
+
+      vex::this_thread::sleep_for(TASK_MONITOR_TIME);
+    }
+
+    return 0;
+  }
+
+  TaskManager::TaskManager()
+  {
+    //*Default priorities. Odometry and motion always come first, and the UI is pushed down during a match.
+    //                                          Odometry Motion Sensor Driver UI Logging
+    const int disabledPriorities[TASK_ROLE_COUNT] =   {12,     10,    10,    8,     7, 4};
+    const int driverPriorities[TASK_ROLE_COUNT] =     {14,     12,    12,    15,    3, 3};
+    const int autonomousPriorities[TASK_ROLE_COUNT] = {15,     14,    12,    7,     2, 3};
+
+    for(int i = 0; i < TASK_ROLE_COUNT; i++)
+    {
+      rolePriorities[robotMode::disabled][i] = disabledPriorities[i];
+      rolePriorities[robotMode::driverControl][i] = driverPriorities[i];
+      rolePriorities[robotMode::autonomousControl][i] = autonomousPriorities[i];
+    }
+  }
+
+  int TaskManager::storeTask(vex::thread *thread, taskRole role, const char *name)
+  {
+    int ID = -1;
+
+    taskLock.lock();
+
+    //*Find a free entry
+    for(int i = 0; i < TASK_MAX_COUNT; i++)
+    {
+      if(!tasks[i].used)
+      {
+        ID = i;
+        break;
+      }
+    }
+
+    //*Fill in the entry
+    if(ID != -1)
+    {
+      taskEntry &task = tasks[ID];
+      snprintf(task.name, sizeof(task.name), "%s", name == nullptr ? "" : name);
+      task.role = role;
+      task.thread = thread;
+      task.used = true;
+      task.appliedPriority = -1;
+      task.workStartTime = 0;
+      task.busyTime = 0;
+      task.usage = 0;
+    }
+
+    taskLock.unlock();
+
+    return ID;
+  }
+
+  int TaskManager::addTask(vex::thread *thread, taskRole role, const char *name)
+  {
+    if(thread == nullptr)
+    {
+      return -1;
+    }
+
+    int ID = storeTask(thread, role, name);
+
+    //Set the priority right away
+    if(ID != -1)
+    {
+      tasks[ID].appliedPriority = getRolePriority(role);
+      thread->setPriority(tasks[ID].appliedPriority);
+    }
+
+    return ID;
+  }
+
+  int TaskManager::addCurrentTask(taskRole role, const char *name)
+  {
+    int ID = storeTask(nullptr, role, name);
+
+    //Set the priority right away. Competition threads start as the mode changes, before the monitor
+    //sees it, so the priority comes from the mode the robot is in now.
+    if(ID != -1)
+    {
+      tasks[ID].appliedPriority = rolePriorities[getCompetitionStatus()][(int)role];
+      vex::this_thread::setPriority(tasks[ID].appliedPriority);
+    }
+
+    return ID;
+  }
+
+  void TaskManager::removeTask(int ID)
+  {
+    if(ID < 0 || ID >= TASK_MAX_COUNT)
+    {
+      return;
+    }
+
+    taskLock.lock();
+    tasks[ID].used = false;
+    taskLock.unlock();
+  }
+
+  void TaskManager::beginWork(int ID)
+  {
+    if(ID < 0 || ID >= TASK_MAX_COUNT || !tasks[ID].used)
+    {
+      return;
+    }
+
+    taskEntry &task = tasks[ID];
+
+    //*Tasks without a thread set their own priority, from the mode the robot is in now
+    if(task.thread == nullptr)
+    {
+      int priority = rolePriorities[getCompetitionStatus()][(int)task.role];
+
+      if(priority != task.appliedPriority)
+      {
+        vex::this_thread::setPriority(priority);
+        task.appliedPriority = priority;
+      }
+    }
+
+    task.workStartTime = vex::timer::systemHighResolution();
+  }
+
+  void TaskManager::endWork(int ID)
+  {
+    if(ID < 0 || ID >= TASK_MAX_COUNT || !tasks[ID].used || tasks[ID].workStartTime == 0)
+    {
+      return;
+    }
+
+    taskEntry &task = tasks[ID];
+    task.busyTime += vex::timer::systemHighResolution() - task.workStartTime;
+    task.workStartTime = 0;
+  }
+
+  evError TaskManager::setRolePriority(taskRole role, robotMode mode, int priority)
+  {
+    if(priority < vex::thread::threadPrioritylow || priority > vex::thread::threadPriorityHigh)
+    {
+      return evError::Invalid_Argument_Data;
+    }
+
+    rolePriorities[mode][(int)role] = priority;
+
+    //Update the threads if the current mode changed
+    if(mode == currentMode)
+    {
+      applyPriorities();
+    }
+
+    return evError::No_Error;
+  }
+
+  int TaskManager::getRolePriority(taskRole role)
+  {
+    return rolePriorities[currentMode][(int)role];
+  }
+
+  void TaskManager::applyPriorities()
+  {
+    taskLock.lock();
+
+    for(int i = 0; i < TASK_MAX_COUNT; i++)
+    {
+      if(tasks[i].used && tasks[i].thread != nullptr)
+      {
+        tasks[i].appliedPriority = getRolePriority(tasks[i].role);
+        tasks[i].thread->setPriority(tasks[i].appliedPriority);
+      }
+    }
+
+    taskLock.unlock();
+  }
+
+  void TaskManager::updateUsage()
+  {
+    uint64_t currentTime = vex::timer::systemHighResolution();
+    uint64_t windowTime = currentTime - windowStartTime;
+
+    taskLock.lock();
+
+    for(int i = 0; i < TASK_MAX_COUNT; i++)
+    {
+      if(tasks[i].used)
+      {
+        tasks[i].usage = (100.0 * tasks[i].busyTime) / windowTime;
+        tasks[i].busyTime = 0;
+      }
+    }
+
+    taskLock.unlock();
+
+    windowStartTime = currentTime;
+  }
+
+  double TaskManager::getUsage(int ID)
+  {
+    if(ID < 0 || ID >= TASK_MAX_COUNT || !tasks[ID].used)
+    {
+      return -1;
+    }
+
+    return tasks[ID].usage;
+  }
+
+  void TaskManager::printUsage()
+  {
+    printf("Task            Role      Priority  CPU\n");
+
+    for(int i = 0; i < TASK_MAX_COUNT; i++)
+    {
+      if(tasks[i].used)
+      {
+        printf("%-15s %-9s %-9d %.1f%%\n", tasks[i].name, roleNames[(int)tasks[i].role],
+               tasks[i].appliedPriority, tasks[i].usage);
+      }
+    }
+  }
+
+  evError TaskManager::startMonitor()
+  {
+    if(monitorThread != nullptr)
+    {
+      return evError::Data_Already_Exists;
+    }
+
+    currentMode = getCompetitionStatus();
+    applyPriorities();
+    windowStartTime = vex::timer::systemHighResolution();
+
+    monitorThread = new vex::thread(taskMonitorThread, this);
+
+    //The monitor has to run to change the priorities of the other threads
+    monitorThread->setPriority(vex::thread::threadPriorityHigh);
+
+    return evError::No_Error;
+  }
+} // namespace evAPI
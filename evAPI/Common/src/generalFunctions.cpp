@@ -1,6 +1,7 @@
 #include <math.h>
 #include "../include/evAPIBasicConfig.h"
 #include "../include/generalFunctions.h"
+#include "../include/ButtonManager.h"
 
 namespace evAPI
 {
@@ -37,104 +38,7 @@ namespace evAPI
 
   buttonStatus getButtonStatus(vex::controllerType type, controllerButtons targetButton)
   {
-    //Button state variables
-    static bool prevButtons[12][2];
-    uint8_t controllerSelection = 0;
-    bool currentButtonState = false;
-    buttonStatus returnStatus;
-
-    //*Select which controller to use
-    vex::controller *selectedController;
-    
-    if(type == vex::controllerType::primary)
-    {
-      selectedController = &primaryController;
-      controllerSelection = 0;
-    }
-
-    else
-    {
-      selectedController = &secondaryController;
-      controllerSelection = 1;
-    }
-
-    //*Check the corresponding button
-    switch(targetButton)
-    {
-      case controllerButtons::L1:
-        currentButtonState = selectedController->ButtonL1.pressing();
-        break;
-
-      case controllerButtons::L2:
-        currentButtonState = selectedController->ButtonL2.pressing();
-        break;
-
-      case controllerButtons::R1:
-        currentButtonState = selectedController->ButtonR1.pressing();
-        break;
-
-      case controllerButtons::R2:
-        currentButtonState = selectedController->ButtonR2.pressing();
-        break;
-
-      case controllerButtons::A:
-        currentButtonState = selectedController->ButtonA.pressing();
-        break;
-
-      case controllerButtons::B:
-        currentButtonState = selectedController->ButtonB.pressing();
-        break;
-
-      case controllerButtons::X:
-        currentButtonState = selectedController->ButtonX.pressing();
-        break;
-
-      case controllerButtons::Y:
-        currentButtonState = selectedController->ButtonY.pressing();
-        break;
-
-      case controllerButtons::UP:
-        currentButtonState = selectedController->ButtonUp.pressing();
-        break;
-
-      case controllerButtons::DOWN:
-        currentButtonState = selectedController->ButtonDown.pressing();
-        break;
-
-      case controllerButtons::LEFT:
-        currentButtonState = selectedController->ButtonLeft.pressing();
-        break;
-
-      case controllerButtons::RIGHT:
-        currentButtonState = selectedController->ButtonRight.pressing();
-        break;
-    }
-
-    //*Determine the state of the target button
-    if(currentButtonState && prevButtons[(int)targetButton][controllerSelection])
-    {
-      returnStatus = buttonStatus::Hold_Press;
-    }
-
-    else if(currentButtonState && !prevButtons[(int)targetButton][controllerSelection])
-    {
-      returnStatus = buttonStatus::Pressed;
-    }
-
-    else if(!currentButtonState && prevButtons[(int)targetButton][controllerSelection])
-    {
-      returnStatus = buttonStatus::Released;
-    }
-
-    else
-    {
-      returnStatus = buttonStatus::Hold_Release;
-    }
-
-    //Store the current state of the button
-    prevButtons[(int)targetButton][controllerSelection] = currentButtonState;
-
-    return returnStatus;
+    return buttonManager.getStatus(type, targetButton);
   }
 
   std::string evErrorToString(evError error)
@@ -0,0 +1,155 @@
+#ifndef _VISION_FILTERS_
+#define _VISION_FILTERS_
+
+#include <stdint.h>
+
+#define MEDIAN_FILTER_MAX_SIZE 15  //most samples a MedianFilter can hold
+#define KALMAN_DEFAULT_GATE 3  //measurements more than this many standard deviations off are rejected
+#define KALMAN_MAX_REJECTS 5  //rejected measurements in a row before the filter jumps to the new value
+#define VISION_MAX_WIDTH 316  //width of the vision sensor image in pixels
+
+/**
+ * @brief A filter for one vision measurement. Filters can be stacked, with the output of one going into
+ *        the next
+ */
+class VisionFilter {
+  public:
+    virtual ~VisionFilter() {}
+
+    /**
+     * @brief Adds a measurement
+     *
+     * @param measurement The new measurement
+     * @return double The filtered value
+     */
+    virtual double update(double measurement) = 0;
+
+    /**
+     * @brief Clears every measurement, so the next one is used as is
+     *
+     */
+    virtual void reset() = 0;
+
+    /**
+     * @return double The filtered value from the last update
+     */
+    virtual double getValue() = 0;
+};
+
+/**
+ * @brief Exponential moving average. Each measurement moves the value part of the way toward it
+ */
+class EMAFilter : public VisionFilter {
+  public:
+    /**
+     * @param alphaIN How much of the way the value moves to each measurement, from 0 to 1. Higher is
+     *                faster but noisier
+     */
+    EMAFilter(double alphaIN);
+
+    double update(double measurement);
+    void reset();
+    double getValue() { return value; }
+
+  private:
+    double alpha;
+    double value = 0;
+    bool hasValue = false;  //true once the first measurement has been added
+};
+
+/**
+ * @brief Median of the last few measurements, which ignores single bad measurements. The window is kept
+ *        sorted as measurements are added, so each update only moves a few values
+ */
+class MedianFilter : public VisionFilter {
+  public:
+    /**
+     * @param sizeIN The amount of measurements the median is taken from. Can be a max of 15
+     */
+    MedianFilter(int sizeIN);
+
+    double update(double measurement);
+    void reset();
+    double getValue();
+
+  private:
+    int size;
+    int count = 0;  //amount of measurements in the window
+    int oldest = 0;  //index of the oldest measurement in history
+    double history[MEDIAN_FILTER_MAX_SIZE];  //measurements in the order they were added
+    double sorted[MEDIAN_FILTER_MAX_SIZE];  //the same measurements from smallest to largest
+};
+
+/**
+ * @brief One dimensional Kalman filter for a value that changes slowly. Measurements that are too far from
+ *        the estimate for its current uncertainty are rejected as outliers
+ */
+class Kalman1D : public VisionFilter {
+  public:
+    /**
+     * @param processNoiseIN How much the real value can change between measurements, as a variance
+     * @param measurementNoiseIN How noisy each measurement is, as a variance
+     */
+    Kalman1D(double processNoiseIN, double measurementNoiseIN);
+
+    /**
+     * @brief Sets how far off a measurement can be before it is rejected
+     *
+     * @param gateIN The amount of standard deviations. 0 turns off rejection
+     */
+    void setGate(double gateIN);
+
+    double update(double measurement);
+    void reset();
+    double getValue() { return estimate; }
+
+    /**
+     * @return double The variance of the estimate
+     */
+    double getVariance() { return variance; }
+
+    /**
+     * @return uint32_t The amount of measurements that have been rejected
+     */
+    uint32_t getRejectCount() { return rejectCount; }
+
+  private:
+    double processNoise;
+    double measurementNoise;
+    double gate = KALMAN_DEFAULT_GATE;
+    double estimate = 0;
+    double variance = 0;
+    bool hasValue = false;  //true once the first measurement has been added
+    int rejectsInRow = 0;
+    uint32_t rejectCount = 0;
+};
+
+/**
+ * @brief Table of the distance for each object width, so the distance curve is only calculated once
+ */
+class WidthDistanceTable {
+  public:
+    /**
+     * @brief Fills the table from the curve y=a^(-(x+b))+c
+     *
+     * @param a A value in function
+     * @param b B value in function
+     * @param c C value in function
+     */
+    void build(double a, double b, double c);
+
+    /**
+     * @param width The width of the object in pixels
+     * @return double The distance to the object
+     */
+    double lookup(int width) {
+      if(width < 0) width = 0;
+      if(width > VISION_MAX_WIDTH) width = VISION_MAX_WIDTH;
+      return table[width];
+    }
+
+  private:
+    float table[VISION_MAX_WIDTH + 1] = {};
+};
+
+#endif //_VISION_FILTERS_
@@ -0,0 +1,54 @@
+#ifndef _VISION_FRAME_
+#define _VISION_FRAME_
+
+#include <stdint.h>
+#include "../../../evAPI/Common/include/evNamespace.h"
+
+#define VISION_FRAME_MAX_OBJECTS 16  //most objects kept from one frame, across all signatures
+#define VISION_CENTER_X 157  //half of the width of the vision sensor image in pixels
+#define VISION_DEGREES_PER_PIXEL (61.0 / 316)  //the sensor sees 61 degrees across 316 pixels
+#define VISION_FRAME_TIME 20  //msec between frames of the vision sensor
+
+/**
+ * @brief Every object seen in one frame of the vision sensor. Each value is kept in its own array, so
+ *        index i of every array is the same object. Objects from the same signature are next to each
+ *        other, largest first.
+ */
+struct VisionFrame {
+  uint8_t count;  //amount of objects in the frame
+  uint32_t frameNumber;  //counts up by one for each frame
+  uint32_t captureTime;  //system time the frame was taken in msec
+
+  int16_t centerX[VISION_FRAME_MAX_OBJECTS];  //pixels from the left of the image
+  int16_t centerY[VISION_FRAME_MAX_OBJECTS];  //pixels from the top of the image
+  int16_t width[VISION_FRAME_MAX_OBJECTS];
+  int16_t height[VISION_FRAME_MAX_OBJECTS];
+  uint8_t signature[VISION_FRAME_MAX_OBJECTS];  //ID of the signature the object matched
+  uint16_t objectID[VISION_FRAME_MAX_OBJECTS];  //stays the same while the object is tracked between frames. Never 0
+
+  //results of processing the frame, for the object picked by the tracker
+  int8_t selected;  //index of the picked object, -1 if there isn't one
+  bool isLocked;
+  evAPI::leftAndRight directionOff;
+  float distance;  //filtered distance to the picked object, or its average width while calibrating
+  uint32_t publishTime;  //system time the frame finished processing in msec
+
+  /**
+   * @brief Picks one object out of the frame
+   *
+   * @param mode How to pick the object
+   * @param signatureID Only pick objects of this signature ID. 0 for any signature
+   * @return int The index of the object, -1 if there are none
+   */
+  int select(evAPI::visionSelection mode, int signatureID = 0) const;
+
+  /**
+   * @brief Finds an object by the ID it was given when it was first seen
+   *
+   * @param ID The ID of the object
+   * @return int The index of the object, -1 if it isn't in the frame
+   */
+  int find(uint16_t ID) const;
+};
+
+#endif //_VISION_FRAME_
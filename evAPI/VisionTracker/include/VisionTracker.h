@@ -1,10 +1,17 @@
 #ifndef _VISION_TRACKER_
 #define _VISION_TRACKER_
 
+#include <atomic>
 #include "../../../evAPI/Common/include/evAPIBasicConfig.h"
 #include "../../../evAPI/Common/include/evNamespace.h"
+#include "../../../evAPI/Common/include/TaskManager.h"
+#include "VisionFrame.h"
+#include "VisionFilters.h"
 
-#define AVERAGE_COUNT 100
+#define VISION_MAX_FILTERS 4  //most filters the distance goes through
+#define VISION_MAX_SIGNATURES 7  //the vision sensor can store 7 signatures
+#define VISION_ASSOCIATION_DISTANCE 30  //most pixels an object can move between frames and keep its ID
+#define VISION_MAILBOX_SIZE 3  //frames in the mailbox, so the capture thread never writes the newest one
 
 // using namespace evAPI;
 
@@ -18,6 +25,23 @@ class VisionTracker {
      * @param visoin::signature* The pointer to the vex signature object of the color it will track
     */
     VisionTracker(vex::vision * sensorAddress, vex::vision::signature * signatureAddress);
+
+    /**
+     * @brief Adds another color to track. Objects of every signature are put into the same frame
+     * 
+     * @param signatureAddress The pointer to the vex signature object of the color it will track
+     * @return int The amount of signatures being tracked, -1 if there is no room for another
+     */
+    int addSignature(vex::vision::signature * signatureAddress);
+
+    /**
+     * @brief Sets how the object used by the single object functions (getObjectXPos, getLockedState,
+     *        distance, and so on) is picked out of each frame
+     * 
+     * @param mode How the object is picked
+     * @param signatureID Only pick objects of this signature ID. 0 for any signature
+     */
+    void setSelection(evAPI::visionSelection mode, int signatureID = 0);
     
     /**
      * @brief Used to set if the LED on the sensor will indicate the state of the tracking
@@ -28,7 +52,8 @@ class VisionTracker {
     bool tglLEDIndicator(bool state);  //allows you to control if the LED on the sensor is used to indicate the object
     
     /**
-     * @brief Used to set if the object will be printed on the screen
+     * @brief Used to set if the object will be printed on the screen. The screen is drawn by drawOverlay,
+     *        which needs to be added to the UI thread
      * 
      * @param state Is the object being printed on the screen
      * @return bool Will bounce back the state passed in 
@@ -73,13 +98,44 @@ class VisionTracker {
      * @return bool Will bounce back the state passed in
      */
     bool tglDistanceCalculation(bool state);  //allow you to turn on and off distance calculations
+
+    /**
+     * @brief Adds a filter to the end of the distance filters. Each distance goes through the filters in
+     *        the order they were added. The default filters are a 3 sample median, then a Kalman filter
+     * 
+     * @param filter The filter. It must exist for as long as this object does
+     * @return int The amount of filters, -1 if there is no room for another
+     */
+    int addDistanceFilter(VisionFilter * filter);
+
+    /**
+     * @brief Removes every distance filter, including the default ones
+     * 
+     */
+    void clearDistanceFilters();
     
     /**
-     * @brief Returns the average distance of object over the count time
+     * @brief Returns the filtered distance of the object
      * 
      * @return double The estimated distance to the object
      */
-    double returnAverageDistance();  //returns the average distance of object over the count time
+    double returnAverageDistance();  //returns the filtered distance of the object
+
+    /**
+     * @brief Finds the distance to an object from its width with the distance curve, without filtering
+     * 
+     * @param width The width of the object in pixels
+     * @return double The distance to the object
+     */
+    double estimateDistance(int width);
+
+    /**
+     * @brief Finds the angle from the middle of the sensor to an object
+     * 
+     * @param centerX The x position of the center of the object in pixels
+     * @return double The angle in degrees. Positive when the object is to the right
+     */
+    double estimateAngle(int centerX);
     
     /**
      * @brief Turns off distace estimation and averages the object width for use in calibrating distace
@@ -90,18 +146,61 @@ class VisionTracker {
     /****** functional code ******/
 
     /**
-     * @brief Takes snapshot and does all math and calculations
+     * @brief Starts a thread that takes a snapshot each frame of the sensor, does all math and
+     *        calculations, and puts the frame in the mailbox. The LED and terminal printing are done on
+     *        this thread too
+     * 
+     * @param period Msec between snapshots. Defaults to the frame rate of the sensor
+     * @return bool False if the thread was already started
+     */
+    bool startThread(uint32_t period = VISION_FRAME_TIME);
+
+    /**
+     * @brief Takes snapshot and does all math and calculations. Does nothing while the thread is running,
+     *        since the thread already does this each frame
      * 
      */
     void trackObject();  //takes snapshot and sets object variables
 
     /**
-     * @brief Return the object count
+     * @brief Returns every object seen in the newest frame in the mailbox. Never waits on the sensor, and
+     *        the frame is copied, so every value in it is from the same snapshot
      * 
-     * @return int How many objects are on the screen
+     * @return VisionFrame The newest frame
+     */
+    VisionFrame getFrame();
+
+    /**
+     * @brief Returns the object picked from the newest frame. Use selected from getFrame to use the index
+     *        with the rest of the frame, since a new frame can come in between calls
+     * 
+     * @return int The index of the object in the frame, -1 if there is no object
+     */
+    int getSelectedObject();
+
+    /**
+     * @brief Draws every object in the newest frame on the brain screen if the screen indicator is on.
+     *        Meant to be run by the UI thread, such as with vexUI::addTimer
+     * 
+     * @param trackerPointer The pointer to the VisionTracker to draw
+     */
+    static void drawOverlay(void * trackerPointer);
+
+    /**
+     * @brief Return the object count of one signature. This is the signature set with setSelection,
+     *        or the signature given to the constructor if objects can be picked from any signature
+     * 
+     * @return int How many objects of the signature are on the screen
      */
     int getObjectCount();
 
+    /**
+     * @brief Return the object count of every signature being tracked
+     * 
+     * @return int How many objects are on the screen
+     */
+    int getTotalObjectCount();
+
     /**
      * @brief Return the object width
      * 
@@ -147,36 +246,86 @@ class VisionTracker {
     evAPI::leftAndRight getOffDirection();
 
   private:
+    /**
+     * @brief Captures a frame, picks the object, runs the distance filters, sets the LED, prints debug
+     *        data, and puts the frame in the mailbox
+     * 
+     */
+    void processFrame();
+
+    /**
+     * @brief Copies a frame into the mailbox in place of the oldest frame there
+     * 
+     * @param frame The finished frame
+     */
+    void publishFrame(const VisionFrame &frame);
+
+    /**
+     * @brief Runs processFrame each period
+     * 
+     * @param trackerPointer The pointer to the VisionTracker
+     * @return int 0
+     */
+    friend int visionThreadFunction(void * trackerPointer);
+
+    /**
+     * @brief Takes a snapshot of each signature and fills the next frame with every object
+     * 
+     */
+    void captureFrame();
+
+    /**
+     * @brief Gives each object in the newest frame the ID of the closest object of the same signature in
+     *        the frame before it, or a new ID if there isn't one close enough
+     * 
+     */
+    void associateObjects();
+
     vex::vision * sensorPointer;
     vex::vision::signature * trackingSignature;
-    bool LEDMode;
-    bool screenMode;
-    bool debugMode;
+    vex::vision::signature * signatures[VISION_MAX_SIGNATURES] = {};
+    int signatureCount = 0;
+    bool LEDMode = false;
+    bool screenMode = false;
+    bool debugMode = false;
     int lockRange;
     int lockTop;
     int lockBottom;
 
     /****** monocular distance ******/
-    bool distanceMode;
+    bool distanceMode = false;
     double aValue;
     double bValue;
     double cValue;
-    double findDistance(int xDimIn) { return(pow(aValue, -(xDimIn + bValue)) + cValue); }
-    double averageNumbers[AVERAGE_COUNT];
-    double averageSum = 0;
-    int headPosition = AVERAGE_COUNT - 1;
-    int tailPosition = 0;
-    bool calibrationMode;
+    WidthDistanceTable distanceTable;  //distance for each object width
+    double findDistance(int xDimIn) { return(distanceTable.lookup(xDimIn)); }
+    VisionFilter * distanceFilters[VISION_MAX_FILTERS] = {};
+    int filterCount = 0;
+    MedianFilter defaultMedian = MedianFilter(3);  //drops single bad widths
+    Kalman1D defaultKalman = Kalman1D(1, 4);  //smooths the distance and rejects jumps
+    double filteredDistance = 0;
+    EMAFilter calibrationWidth = EMAFilter(0.02);  //average width while calibrating, about the last 50 frames
+    bool calibrationMode = false;
 
     /****** object data ******/
-    int objectCount;
-    int objectXDim;
-    int objectYDim;
-    int objectXPos;
-    int objectYPos;
-
-    bool isLocked;
-    evAPI::leftAndRight directionOff;
+    VisionFrame frames[2] = {};  //the frame being processed and the one before it
+    int currentFrame = 0;  //index of the frame being processed
+    uint16_t nextObjectID = 1;
+    evAPI::visionSelection selectionMode = evAPI::visionSelection::Largest;
+    int selectionSignature = 0;  //signature ID objects are picked from, 0 for any
+    bool isLocked = false;
+    evAPI::leftAndRight directionOff = evAPI::LEFT;
+
+    /****** capture thread ******/
+    vex::thread * visionThread = nullptr;
+    int visionTaskID = -1;
+    uint32_t capturePeriod = VISION_FRAME_TIME;
+
+    //the newest finished frames. Each frame's sequence is odd while it is being written, so a reader can
+    //tell if its copy was written over and copy it again
+    VisionFrame mailbox[VISION_MAILBOX_SIZE] = {};
+    std::atomic<uint32_t> mailboxSequence[VISION_MAILBOX_SIZE];
+    std::atomic<int> newestFrame;  //index of the newest frame in the mailbox
 
 };
 
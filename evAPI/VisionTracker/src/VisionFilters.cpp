@@ -0,0 +1,134 @@
+#include <math.h>
+#include "../include/VisionFilters.h"
+
+/****** EMA ******/
+EMAFilter::EMAFilter(double alphaIN) {
+  if(alphaIN < 0) alphaIN = 0;
+  if(alphaIN > 1) alphaIN = 1;
+  alpha = alphaIN;
+}
+
+double EMAFilter::update(double measurement) {
+  if(hasValue) {
+    value += alpha * (measurement - value);
+  } else {
+    value = measurement;
+    hasValue = true;
+  }
+  return value;
+}
+
+void EMAFilter::reset() {
+  value = 0;
+  hasValue = false;
+}
+
+/****** median ******/
+MedianFilter::MedianFilter(int sizeIN) {
+  if(sizeIN < 1) sizeIN = 1;
+  if(sizeIN > MEDIAN_FILTER_MAX_SIZE) sizeIN = MEDIAN_FILTER_MAX_SIZE;
+  size = sizeIN;
+}
+
+double MedianFilter::update(double measurement) {
+  int position;
+
+  if(count < size) {
+    //the window isn't full, so the new measurement goes on the end
+    history[count] = measurement;
+    position = count;
+    count++;
+  } else {
+    //take the oldest measurement out of the sorted list
+    double removed = history[oldest];
+    history[oldest] = measurement;
+    oldest = (oldest + 1) % size;
+
+    position = 0;
+    while(position < count - 1 && sorted[position] != removed) position++;
+  }
+
+  //move the new measurement into place from where the old one was
+  sorted[position] = measurement;
+  while(position > 0 && sorted[position - 1] > measurement) {
+    sorted[position] = sorted[position - 1];
+    position--;
+    sorted[position] = measurement;
+  }
+  while(position < count - 1 && sorted[position + 1] < measurement) {
+    sorted[position] = sorted[position + 1];
+    position++;
+    sorted[position] = measurement;
+  }
+
+  return getValue();
+}
+
+void MedianFilter::reset() {
+  count = 0;
+  oldest = 0;
+}
+
+double MedianFilter::getValue() {
+  if(count == 0) return 0;
+  if(count % 2 == 1) return sorted[count / 2];
+  return (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+}
+
+/****** Kalman ******/
+Kalman1D::Kalman1D(double processNoiseIN, double measurementNoiseIN) {
+  processNoise = processNoiseIN;
+  measurementNoise = measurementNoiseIN;
+}
+
+void Kalman1D::setGate(double gateIN) {
+  gate = gateIN;
+}
+
+double Kalman1D::update(double measurement) {
+  if(!hasValue) {
+    estimate = measurement;
+    variance = measurementNoise;
+    hasValue = true;
+    return estimate;
+  }
+
+  //the value may have changed since the last measurement
+  variance += processNoise;
+
+  //reject measurements that are too far off, unless they keep happening
+  double innovation = measurement - estimate;
+  double innovationVariance = variance + measurementNoise;
+  if(gate > 0 && innovation * innovation > gate * gate * innovationVariance) {
+    rejectCount++;
+    rejectsInRow++;
+    if(rejectsInRow < KALMAN_MAX_REJECTS) return estimate;
+
+    //the value really changed, so start over from the new measurement
+    estimate = measurement;
+    variance = measurementNoise;
+    rejectsInRow = 0;
+    return estimate;
+  }
+  rejectsInRow = 0;
+
+  //move the estimate toward the measurement based on how sure each one is
+  double gain = variance / innovationVariance;
+  estimate += gain * innovation;
+  variance *= 1 - gain;
+  return estimate;
+}
+
+void Kalman1D::reset() {
+  estimate = 0;
+  variance = 0;
+  hasValue = false;
+  rejectsInRow = 0;
+}
+
+/****** distance table ******/
+void WidthDistanceTable::build(double a, double b, double c) {
+  for(int width = 0; width <= VISION_MAX_WIDTH; width++) {
+    table[width] = pow(a, -(width + b)) + c;
+  }
+}
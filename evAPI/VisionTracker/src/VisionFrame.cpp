@@ -0,0 +1,41 @@
+#include <stdlib.h>
+#include "../include/VisionFrame.h"
+
+int VisionFrame::select(evAPI::visionSelection mode, int signatureID) const {
+  int bestIndex = -1;
+  int bestScore = 0;
+
+  for(int i = 0; i < count; i++) {
+    if(signatureID != 0 && signature[i] != signatureID) continue;
+
+    //higher scores are better
+    int score;
+    switch(mode) {
+      default:
+      case evAPI::visionSelection::Largest:
+        score = width[i] * height[i];
+        break;
+      case evAPI::visionSelection::Nearest:
+        score = centerY[i] + height[i] / 2;  //bottom edge of the object
+        break;
+      case evAPI::visionSelection::MostCentered:
+        score = -abs(centerX[i] - VISION_CENTER_X);
+        break;
+    }
+
+    if(bestIndex == -1 || score > bestScore) {
+      bestIndex = i;
+      bestScore = score;
+    }
+  }
+
+  return bestIndex;
+}
+
+int VisionFrame::find(uint16_t ID) const {
+  for(int i = 0; i < count; i++) {
+    if(objectID[i] == ID) return i;
+  }
+
+  return -1;
+}
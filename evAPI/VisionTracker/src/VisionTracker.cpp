@@ -1,9 +1,34 @@
+#include <stdlib.h>
 #include "../include/VisionTracker.h"
 
 VisionTracker::VisionTracker(vex::vision * sensorAddress, vex::vision::signature * signatureAddress) {
   fflush(stdout);
 	sensorPointer = sensorAddress;
 	trackingSignature = signatureAddress;
+  addSignature(signatureAddress);
+  addDistanceFilter(&defaultMedian);
+  addDistanceFilter(&defaultKalman);
+
+  //no object has been seen until the first frame is processed
+  for(int i = 0; i < VISION_MAILBOX_SIZE; i++) {
+    mailbox[i].selected = -1;
+    mailboxSequence[i].store(0);
+  }
+  frames[0].selected = -1;
+  frames[1].selected = -1;
+  newestFrame.store(0);
+}
+
+int VisionTracker::addSignature(vex::vision::signature * signatureAddress) {
+  if(signatureCount >= VISION_MAX_SIGNATURES) return -1;
+  signatures[signatureCount] = signatureAddress;
+  signatureCount++;
+  return signatureCount;
+}
+
+void VisionTracker::setSelection(evAPI::visionSelection mode, int signatureID) {
+  selectionMode = mode;
+  selectionSignature = signatureID;
 }
 
 bool VisionTracker::tglLEDIndicator(bool state) {
@@ -23,40 +48,111 @@ bool VisionTracker::tglDebugMode(bool state) {
 
 bool VisionTracker::tglDistanceCalculation(bool state) {
   distanceMode = state;
-  for(int i = 0; i < AVERAGE_COUNT; i++) {
-    averageNumbers[i] = 0;
+  for(int i = 0; i < filterCount; i++) {
+    distanceFilters[i]->reset();
   }
+  filteredDistance = 0;
   return distanceMode;
 }
 
+int VisionTracker::addDistanceFilter(VisionFilter * filter) {
+  if(filterCount >= VISION_MAX_FILTERS) return -1;
+  distanceFilters[filterCount] = filter;
+  filterCount++;
+  return filterCount;
+}
+
+void VisionTracker::clearDistanceFilters() {
+  filterCount = 0;
+}
+
 void VisionTracker::setupDistanceMath(double a, double b, double c) {
   aValue = a;
   bValue = b;
   cValue = c;
+  distanceTable.build(a, b, c);
 }
 
 int VisionTracker::setLockRange(int range) {
   lockRange = range;
-  lockTop = 157 + range; //157 is half of the total vision sensor range
-  lockBottom = 157 - range;
+  lockTop = VISION_CENTER_X + range;
+  lockBottom = VISION_CENTER_X - range;
   return lockRange;
 }
 
 double VisionTracker::returnAverageDistance() {
-  return(averageSum / AVERAGE_COUNT);
+  return(getFrame().distance);
 }
 
-void VisionTracker::trackObject() {
-  sensorPointer->takeSnapshot(*trackingSignature);
-    //sets variables to biggest object values
-    objectXDim = sensorPointer->objects[0].width;
-    objectYDim = sensorPointer->objects[0].height;
-    objectXPos = sensorPointer->objects[0].centerX;
-    objectYPos = sensorPointer->objects[0].centerY;
-    objectCount = sensorPointer->objectCount;
-
-   if(objectCount > 0) {
-    //calculates if it is locked and which direction off it is
+void VisionTracker::captureFrame() {
+  const VisionFrame &previousFrame = frames[currentFrame];
+  currentFrame = 1 - currentFrame;
+  VisionFrame &frame = frames[currentFrame];
+
+  frame.count = 0;
+  frame.frameNumber = previousFrame.frameNumber + 1;
+  frame.captureTime = vex::timer::system();
+
+  //copy every object of each signature into the frame
+  for(int i = 0; i < signatureCount; i++) {
+    sensorPointer->takeSnapshot(*signatures[i]);
+    int snapshotCount = sensorPointer->objectCount;
+
+    for(int j = 0; j < snapshotCount && frame.count < VISION_FRAME_MAX_OBJECTS; j++) {
+      int index = frame.count;
+      frame.centerX[index] = sensorPointer->objects[j].centerX;
+      frame.centerY[index] = sensorPointer->objects[j].centerY;
+      frame.width[index] = sensorPointer->objects[j].width;
+      frame.height[index] = sensorPointer->objects[j].height;
+      frame.signature[index] = signatures[i]->id;
+      frame.count++;
+    }
+  }
+
+  associateObjects();
+}
+
+void VisionTracker::associateObjects() {
+  const VisionFrame &previousFrame = frames[1 - currentFrame];
+  VisionFrame &frame = frames[currentFrame];
+  bool matched[VISION_FRAME_MAX_OBJECTS] = {};
+
+  //the largest objects are first, so they get the first pick of the old IDs
+  for(int i = 0; i < frame.count; i++) {
+    int closestObject = -1;
+    int closestDistance = VISION_ASSOCIATION_DISTANCE + 1;
+
+    for(int j = 0; j < previousFrame.count; j++) {
+      if(matched[j] || previousFrame.signature[j] != frame.signature[i]) continue;
+
+      int distance = abs(frame.centerX[i] - previousFrame.centerX[j]) + abs(frame.centerY[i] - previousFrame.centerY[j]);
+      if(distance < closestDistance) {
+        closestObject = j;
+        closestDistance = distance;
+      }
+    }
+
+    if(closestObject != -1) {
+      matched[closestObject] = true;
+      frame.objectID[i] = previousFrame.objectID[closestObject];
+    } else {
+      frame.objectID[i] = nextObjectID;
+      nextObjectID++;
+      if(nextObjectID == 0) nextObjectID = 1;  //0 is never used as an ID
+    }
+  }
+}
+
+void VisionTracker::processFrame() {
+  captureFrame();
+  VisionFrame &frame = frames[currentFrame];
+
+  //picks the object, then calculates if it is locked and which direction off it is
+  frame.selected = frame.select(selectionMode, selectionSignature);
+  if(frame.selected != -1) {
+    int objectXPos = frame.centerX[frame.selected];
+    int objectXDim = frame.width[frame.selected];
+
     if(objectXPos >= lockBottom && objectXPos <= lockTop) {
       isLocked = true;
     } else {
@@ -67,62 +163,30 @@ void VisionTracker::trackObject() {
         directionOff = evAPI::RIGHT;
       }
     }
-  }
 
-  //run distance summations
-  if(objectCount > 0) {
+    //run distance summations
     if(distanceMode) {
-      averageSum = averageSum - averageNumbers[tailPosition];
-      tailPosition++;
-      headPosition++;
-      if(tailPosition == AVERAGE_COUNT) tailPosition = 0;
-      if(headPosition == AVERAGE_COUNT) headPosition = 0;
-      averageNumbers[headPosition] = findDistance(objectXDim);
-      averageSum = averageSum + averageNumbers[headPosition];
+      filteredDistance = findDistance(objectXDim);
+      for(int i = 0; i < filterCount; i++) {
+        filteredDistance = distanceFilters[i]->update(filteredDistance);
+      }
     }
-  }
 
-  //run calibration summations
-  if(objectCount > 0) {
+    //run calibration summations
     if(calibrationMode) {
-      averageSum = averageSum - averageNumbers[tailPosition];
-      tailPosition++;
-      headPosition++;
-      if(tailPosition == AVERAGE_COUNT) tailPosition = 0;
-      if(headPosition == AVERAGE_COUNT) headPosition = 0;
-      averageNumbers[headPosition] = objectXDim;
-      averageSum = averageSum + averageNumbers[headPosition];
-    }
-  }
-  
-  //prints object to screen
-  if(screenMode) {
-    Brain.Screen.clearScreen();
-    if(objectCount > 0) {
-      //draw border
-      Brain.Screen.setFillColor(vex::color::black);
-      Brain.Screen.setPenColor(vex::color::white);
-      Brain.Screen.setPenWidth(5);
-      Brain.Screen.drawRectangle(10, 10, 326, 222);
-
-      //set draw object
-      Brain.Screen.setPenWidth(1);
-      if(isLocked) {
-        Brain.Screen.setFillColor(vex::color::blue);
-      } else {
-        if(directionOff == evAPI::LEFT) {
-          Brain.Screen.setFillColor(vex::color::green);
-        } else if(directionOff == evAPI::RIGHT) {
-          Brain.Screen.setFillColor(vex::color::red);
-        }
-      }
-      Brain.Screen.drawRectangle(sensorPointer->objects[0].originX + 10, sensorPointer->objects[0].originY + 10, objectXDim, objectYDim);
+      calibrationWidth.update(objectXDim);
     }
+  } else {
+    isLocked = false;
   }
 
+  frame.isLocked = isLocked;
+  frame.directionOff = directionOff;
+  frame.distance = calibrationMode ? calibrationWidth.getValue() : filteredDistance;
+
   //set sensor LED color
   if(LEDMode) {
-    if(objectCount > 0) {
+    if(frame.selected != -1) {
       if(isLocked) {
         sensorPointer->setLedColor(0, 0, 255);
       } else {
@@ -136,56 +200,189 @@ void VisionTracker::trackObject() {
       sensorPointer->setLedColor(0, 0, 0);
     }
   }
-  
+
+  frame.publishTime = vex::timer::system();
+  publishFrame(frame);
+
   //print data to terminal
   if(debugMode) {
+    int selected = frame.selected;
     if(distanceMode) {
-      printf("ball distance = %f\n", returnAverageDistance());
-      printf("averageSum = %f, ", averageSum);
-      printf("headPos = %i, ", headPosition);
-      printf("tailPos = %i\n", tailPosition);
+      printf("ball distance = %f, ", frame.distance);
+      printf("raw distance = %f\n", selected != -1 ? findDistance(frame.width[selected]) : 0);
     }
-    printf("xPos = %i, ", objectXPos);
-    printf("yPos = %i, ", objectYPos);
-    printf("xDim = %i, ", objectXDim);
-    printf("yDim = %i, ", objectYDim);
-    printf("objCnt = %i, ", objectCount);
+    printf("xPos = %i, ", selected != -1 ? frame.centerX[selected] : 0);
+    printf("yPos = %i, ", selected != -1 ? frame.centerY[selected] : 0);
+    printf("xDim = %i, ", selected != -1 ? frame.width[selected] : 0);
+    printf("yDim = %i, ", selected != -1 ? frame.height[selected] : 0);
+    printf("objCnt = %i, ", selected != -1 ? frame.count : 0);
     printf("isLock = %i\n\n", isLocked);
   }
-  if(calibrationMode) printf("%i\n\n", int(returnAverageDistance()));
-  
+  if(calibrationMode) printf("%i\n\n", int(frame.distance));
+}
+
+void VisionTracker::publishFrame(const VisionFrame &frame) {
+  //write over the oldest frame, never the newest one that readers are most likely copying
+  int index = (newestFrame.load() + 1) % VISION_MAILBOX_SIZE;
+
+  mailboxSequence[index].fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  mailbox[index] = frame;
+  mailboxSequence[index].fetch_add(1, std::memory_order_release);
+
+  newestFrame.store(index, std::memory_order_release);
+}
+
+int visionThreadFunction(void * trackerPointer) {
+  VisionTracker * tracker = (VisionTracker *)trackerPointer;
+  uint32_t nextTime = vex::timer::system();
+
+  while(1) {
+    evAPI::taskManager.beginWork(tracker->visionTaskID);
+    tracker->processFrame();
+    evAPI::taskManager.endWork(tracker->visionTaskID);
+
+    //keep to the frame rate, unless a frame took so long that it is already time for the next one
+    nextTime += tracker->capturePeriod;
+    int32_t sleepTime = (int32_t)(nextTime - vex::timer::system());
+    if(sleepTime > 0) {
+      vex::this_thread::sleep_for(sleepTime);
+    } else {
+      nextTime = vex::timer::system();
+      vex::this_thread::yield();
+    }
+  }
+
+  return 0;
+}
+
+bool VisionTracker::startThread(uint32_t period) {
+  if(visionThread != nullptr) return false;
+
+  capturePeriod = period;
+  visionThread = new vex::thread(visionThreadFunction, this);
+  visionTaskID = evAPI::taskManager.addTask(visionThread, evAPI::taskRole::Sensor, "Vision");
+  return true;
+}
+
+void VisionTracker::trackObject() {
+  //the thread already processes every frame
+  if(visionThread != nullptr) return;
+
+  processFrame();
+}
+
+VisionFrame VisionTracker::getFrame() {
+  VisionFrame frame;
+
+  //copy again if the capture thread started writing over the frame during the copy
+  while(1) {
+    int index = newestFrame.load(std::memory_order_acquire);
+    uint32_t sequence = mailboxSequence[index].load(std::memory_order_acquire);
+    if(sequence % 2 == 1) continue;
+
+    frame = mailbox[index];
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if(mailboxSequence[index].load(std::memory_order_relaxed) == sequence) return frame;
+  }
+}
+
+int VisionTracker::getSelectedObject() {
+  return getFrame().selected;
+}
+
+void VisionTracker::drawOverlay(void * trackerPointer) {
+  VisionTracker * tracker = (VisionTracker *)trackerPointer;
+  if(!tracker->screenMode) return;
+
+  VisionFrame frame = tracker->getFrame();
+  int selected = frame.selected;
+
+  //prints object to screen
+  Brain.Screen.clearScreen();
+  if(selected != -1) {
+    //draw border
+    Brain.Screen.setFillColor(vex::color::black);
+    Brain.Screen.setPenColor(vex::color::white);
+    Brain.Screen.setPenWidth(5);
+    Brain.Screen.drawRectangle(10, 10, 326, 222);
+
+    //draw every object, then fill in the picked one
+    Brain.Screen.setPenWidth(1);
+    Brain.Screen.setFillColor(vex::color::transparent);
+    for(int i = 0; i < frame.count; i++) {
+      if(i == selected) continue;
+      Brain.Screen.drawRectangle(frame.centerX[i] - frame.width[i] / 2 + 10, frame.centerY[i] - frame.height[i] / 2 + 10, frame.width[i], frame.height[i]);
+    }
+
+    if(frame.isLocked) {
+      Brain.Screen.setFillColor(vex::color::blue);
+    } else {
+      if(frame.directionOff == evAPI::LEFT) {
+        Brain.Screen.setFillColor(vex::color::green);
+      } else if(frame.directionOff == evAPI::RIGHT) {
+        Brain.Screen.setFillColor(vex::color::red);
+      }
+    }
+    Brain.Screen.drawRectangle(frame.centerX[selected] - frame.width[selected] / 2 + 10, frame.centerY[selected] - frame.height[selected] / 2 + 10, frame.width[selected], frame.height[selected]);
+  }
+}
+
+double VisionTracker::estimateDistance(int width) {
+  return(findDistance(width));
+}
+
+double VisionTracker::estimateAngle(int centerX) {
+  return((centerX - VISION_CENTER_X) * VISION_DEGREES_PER_PIXEL);
 }
 
 void VisionTracker::enableCalibration() {
   tglDebugMode(false);
   tglDistanceCalculation(false);
+  calibrationWidth.reset();
   calibrationMode = true;
 }
 
 int VisionTracker::getObjectCount() {
-  return(objectCount);
+  VisionFrame frame = getFrame();
+
+  //count the signature objects are picked from, or the first signature if any can be picked
+  int signatureID = selectionSignature != 0 ? selectionSignature : trackingSignature->id;
+  int count = 0;
+  for(int i = 0; i < frame.count; i++) {
+    if(frame.signature[i] == signatureID) count++;
+  }
+  return(count);
+}
+
+int VisionTracker::getTotalObjectCount() {
+  return(getFrame().count);
 }
 
 int VisionTracker::getObjectXDim() {
-  return(objectXDim);
+  VisionFrame frame = getFrame();
+  return(frame.selected != -1 ? frame.width[frame.selected] : 0);
 }
 
 int VisionTracker::getObjectYDim() {
-  return(objectYDim);
+  VisionFrame frame = getFrame();
+  return(frame.selected != -1 ? frame.height[frame.selected] : 0);
 }
 
 int VisionTracker::getObjectXPos() {
-  return(objectXPos);
+  VisionFrame frame = getFrame();
+  return(frame.selected != -1 ? frame.centerX[frame.selected] : 0);
 }
 
 int VisionTracker::getObjectYPos() {
-  return(objectYPos);
+  VisionFrame frame = getFrame();
+  return(frame.selected != -1 ? frame.centerY[frame.selected] : 0);
 }
 
 bool VisionTracker::getLockedState() {
-  return(isLocked);
+  return(getFrame().isLocked);
 }
 
 evAPI::leftAndRight VisionTracker::getOffDirection() {
-  return(directionOff);
+  return(getFrame().directionOff);
 }
\ No newline at end of file
@@ -4,6 +4,10 @@
 #include "../evAPI/Common/include/generalFunctions.h"
 #include "../evAPI/Common/include/evNamespace.h"
 #include "../evAPI/Common/include/PID.h"
+#include "../evAPI/Common/include/ConfigStore.h"
+#include "../evAPI/Common/include/TaskManager.h"
+#include "../evAPI/Common/include/LoopProfiler.h"
+#include "../evAPI/Common/include/ButtonManager.h"
 #include "../evAPI/Common/include/colors.h"
 #include "../evAPI/Common/include/evAPIBasicConfig.h"
 #include "../evAPI/Common/include/vexPrivateRebuild.h"
@@ -14,5 +18,6 @@
 #include "../evAPI/VisionTracker/include/VisionTracker.h"
 
 #include "../evAPI/vexUI/Common/include/vexUI.h"
+#include "../evAPI/vexUI/PIDTuner/include/PIDTuner.h"
 
 #endif // EVAPIFILES_H
\ No newline at end of file
@@ -4,9 +4,21 @@
 #include "../../../Common/include/evAPIBasicConfig.h"
 #include "../../../Common/include/evNamespace.h"
 #include "../../Drivetrain/include/Drive.h"
+#include "InputShaper.h"
+#include "DriverRecorder.h"
 
 // using namespace vex;
 
+#define CURVATURE_QUICK_TURN_THRESHOLD 10  // drive stick percent below which Curvature mode blends into turning in place
+#define SERVO_DEFAULT_TURN_RATE 180  // deg/s the target heading turns at full stick in ServoSteering Rate mode
+#define SERVO_MAX_LEAD 30  // most the Rate mode target can get ahead of the robot in degrees
+#define SERVO_ABSOLUTE_RANGE 90  // degrees the target heading moves at full stick in Absolute mode
+#define SERVO_RESTART_TIME 100  // msec without a ServoSteering loop before the target is reset
+#define DRIVER_THREAD_POLL_TIME 2  // msec between checks for new controller data in the driver thread
+#define DRIVER_THREAD_MAX_PERIOD 20  // most msec the driver thread waits for new controller data before running
+#define DRIVER_THREAD_MAX_COUNT 2  // most driver control threads that can run at once
+#define DRIVER_MAX_LOOP_TIME 100  // msec between driverLoops after which the loop counts as restarted
+
 namespace evAPI {
   class DriverBaseControl {
     public:
@@ -35,19 +47,182 @@ namespace evAPI {
        */
       void setPrimaryStick(joystickType primaryStickIN);
 
+      /**
+       * @brief Change the type of controlling that will be used, such as switching to ServoSteering while
+       *        lining up with a goal
+       * 
+       * @param driveTypeIN The type of controlling that will be used
+       */
+      void setDriveMode(driveMode driveTypeIN);
+
+      /**
+       * @return driveMode The type of controlling being used
+       */
+      driveMode getDriveMode();
+
+      /**
+       * @brief Set the constants of the PID that holds the heading in ServoSteering
+       * 
+       * @param kp The KP factor, in percent power per degree
+       * @param ki The KI factor
+       * @param kd The KD factor
+       */
+      void setupHeadingPID(double kp, double ki, double kd);
+
+      /**
+       * @brief Set how the stick sets the target heading in ServoSteering
+       * 
+       * @param mode The steering mode
+       */
+      void setSteeringMode(steeringMode mode);
+
+      /**
+       * @brief Set how fast the target heading turns at full stick in the Rate steering mode
+       * 
+       * @param rate The turn rate in degrees per second
+       */
+      void setMaxTurnRate(double rate);
+
+      /**
+       * @brief Hold the heading the robot is facing now. In the Absolute steering mode the stick angles
+       *        are measured from this heading
+       * 
+       */
+      void resetHeadingTarget();
+
+      /**
+       * @return double The heading ServoSteering is holding in degrees
+       */
+      double getHeadingTarget();
+
+      /**
+       * @brief Set the deadband and curve of the drive stick. Tank drive uses this for both sticks
+       * 
+       * @param deadband Inputs smaller than this percent are ignored
+       * @param curve The curve that maps the stick to the motor power
+       * @param strength How strong the curve is. See inputCurve for the range of each curve
+       */
+      void setDriveShaping(double deadband, inputCurve curve = inputCurve::Linear, double strength = 0);
+
+      /**
+       * @brief Set the deadband and curve of the turn stick
+       * 
+       * @param deadband Inputs smaller than this percent are ignored
+       * @param curve The curve that maps the stick to the motor power
+       * @param strength How strong the curve is. See inputCurve for the range of each curve
+       */
+      void setTurnShaping(double deadband, inputCurve curve = inputCurve::Linear, double strength = 0);
+
+      /**
+       * @brief Set the slew rate of each side of the base, which stops the robot from tipping on hard
+       *        changes in direction
+       * 
+       * @param rate The most the power of a side can change each second in percent. 0 turns off the limit
+       */
+      void setSlewRate(double rate);
+
+      /**
+       * @brief Loads the handicaps ("driver.driveHandicap" and "driver.turnHandicap"), the stick shaping
+       *        ("driver.driveDeadband", "driver.driveCurve", "driver.driveCurveStrength", and the same
+       *        for "turn"), "driver.slewRatePerSec", the ServoSteering settings ("driver.steeringMode" and
+       *        "driver.maxTurnRate"), and the heading PID ("driver.headingPID.kp" and the other PID keys)
+       *        from a config store. Curves are 0 for linear, 1 for expo, and 2 for cubic. Steering modes
+       *        are 0 for rate, 1 for absolute, and 2 for field centric. They are reloaded every time the
+       *        config store is reloaded
+       * 
+       * @param config The config store to read from. It must exist for as long as this object does
+       * @return evError Range_Limit_Reached if the config store can't take another reload callback
+       */
+      evError useConfig(ConfigStore &config);
+
       /**
        * @brief Called in the main driver contorl loop to drive the base
        * 
        */
       void driverLoop();
 
+      /**
+       * @brief Starts a thread that runs driverLoop as soon as the controller sends new stick positions,
+       *        instead of waiting for the next loop of usercontrol. The thread only drives the base during
+       *        driver control, and runs at the Driver priority of the task manager. Don't call driverLoop
+       *        from usercontrol once the thread is started
+       * 
+       * @return evError Data_Already_Exists if the thread is already running, Range_Limit_Reached if too
+       *         many driver threads are running
+       */
+      evError startThread();
+
+      /**
+       * @brief Stops the driver thread from moving the base, such as while something else is driving it
+       * 
+       * @param pause True to stop the thread from moving the base
+       */
+      void setPaused(bool pause);
+
+      /**
+       * @return true The driver thread is stopped from moving the base
+       */
+      bool isPaused();
+
+      /**
+       * @return double The time from the controller data arriving to the motors being set on the last
+       *         loop of the driver thread in msec
+       */
+      double getInputLatency();
+
+      /**
+       * @brief Sends the side powers from each driverLoop to a recorder, so the driving can be replayed
+       *        in autonomous
+       * 
+       * @param recorderIN The recorder. Set to nullptr to stop sending the powers
+       */
+      void setRecorder(DriverRecorder * recorderIN);
+
+      /**
+       * @returns The profiler for the driver control loop
+       */
+      LoopProfiler& getProfiler();
+
     private:
+      /**
+       * @brief Finds the powers of each side for ServoSteering
+       * 
+       * @param driveInput The forward stick position in percent
+       * @param turnInput The side to side stick position in percent
+       * @param loopTime The time since the last driverLoop in seconds
+       * @param leftSpeed Set to the power of the left side
+       * @param rightSpeed Set to the power of the right side
+       */
+      void servoSteer(double driveInput, double turnInput, double loopTime, double &leftSpeed, double &rightSpeed);
+
       vex::controller * vexController;
       driveMode driverType;
       Drive * drivetrain;
       double driveHandicap = 1;
       double turnHandicap = 1;
+      InputShaper driveShaper;  // shaping of the drive stick
+      InputShaper turnShaper;  // shaping of the turn stick
+      SlewLimiter leftSlew;  // limits the change in left side power
+      SlewLimiter rightSlew;  // limits the change in right side power
+      PID headingPID;  // holds the heading in ServoSteering
+      steeringMode steering = steeringMode::Rate;
+      double maxTurnRate = SERVO_DEFAULT_TURN_RATE;  // deg/s at full stick in Rate mode
+      double targetHeading = 0;  // heading ServoSteering is holding
+      double referenceHeading = 0;  // heading the Absolute mode stick angles are measured from
+      uint32_t lastServoTime = 0;  // system time of the last ServoSteering loop in msec
+      uint64_t lastLoopTime = 0;  // system time of the last driverLoop in usec
       joystickType primaryStick = leftStick;
+      ConfigStore * config = nullptr;
+      LoopProfiler profiler = LoopProfiler("Driver Control", 20);  // timing of driverLoop
+      DriverRecorder * recorder = nullptr;  // records the side powers. nullptr if there isn't one
+      vex::thread * driverThread = nullptr;  // runs driverLoop when the controller sends new data
+      int driverTaskID = -1;  // ID of the driver thread in the task manager
+      volatile bool paused = false;  // true if the driver thread can't move the base
+      volatile uint64_t inputTime = 0;  // system time the newest controller data arrived in usec. 0 once it is used
+      double inputLatency = 0;  // msec from the controller data arriving to the motors being set
+      friend void driverConfigReload(void *driverControlObject);
+      friend void driverInputChanged();
+      friend int driverThreadFunction(void *driverControlObject);
   };
 }
 
@@ -0,0 +1,144 @@
+#ifndef DRIVERRECORDER_H_
+#define DRIVERRECORDER_H_
+
+#include <stdint.h>
+#include "../../../Common/include/evAPIBasicConfig.h"
+#include "../../../Common/include/evErrorTypes.h"
+#include "../../../Common/include/ButtonManager.h"
+#include "../../Drivetrain/include/Drive.h"
+
+#define DRIVER_RECORD_MAX_COUNT 8192  // most records kept, 8 bytes each. About 2.5 minutes when the base is always changing
+#define DRIVER_RECORD_KEYFRAME_TIME 100  // most msec between records, so the heading is saved while the inputs are steady
+#define DRIVER_RECORD_VERSION 1  // version of the file format
+#define DRIVER_REPLAY_LOOP_TIME 5  // msec between updates while replaying
+#define DRIVER_REPLAY_DEFAULT_KP 1  // percent power added per degree of heading error while replaying
+
+namespace evAPI {
+  /**
+   * @brief One step of a recording. Only saved when the powers or buttons change, or every keyframe time.
+   *        The time is stored as the change from the last record, but the powers, buttons, and heading
+   *        are stored whole. That keeps every record the same size and lets any record be read on its
+   *        own, which the replay needs to look ahead to the next heading
+   */
+  struct driverRecord {
+    uint16_t timeChange;  // msec since the last record
+    int8_t leftPower;  // percent power sent to the left side
+    int8_t rightPower;  // percent power sent to the right side
+    uint16_t buttons;  // buttons held on the primary controller, as a ButtonManager mask
+    uint16_t heading;  // heading of the robot in hundredths of a degree
+  };
+
+  /**
+   * @brief Start of a recording file. The records follow right after it
+   */
+  struct driverRecordHeader {
+    char magic[4];  // "DRVR"
+    uint16_t version;  // DRIVER_RECORD_VERSION
+    uint16_t recordSize;  // size of each record in bytes
+    uint32_t recordCount;  // amount of records in the file
+  };
+
+  class DriverRecorder {
+    public:
+      /**
+       * @brief Construct a new Driver Recorder object
+       *
+       * @param drivetrainIN The drivetrain the powers are recorded from and replayed on
+       */
+      DriverRecorder(Drive * drivetrainIN);
+      ~DriverRecorder();
+
+      /**
+       * @brief Clears the records and starts recording. The records are added by DriverBaseControl
+       *        once it is given this recorder with setRecorder
+       *
+       * @return evError Object_State_Is_Changing if a recording is being replayed
+       */
+      evError startRecording();
+
+      /**
+       * @brief Stops recording and saves the records to the SD card
+       *
+       * @param fileName The name of the file
+       * @return evError No_Data_Defined if nothing was recorded, No_Device_Defined if there is no SD card,
+       *         Unknown_Error if the file couldn't be written
+       */
+      evError stopRecording(const char *fileName);
+
+      /**
+       * @brief Adds the powers from one loop of driver control to the recording. Does nothing if the
+       *        recorder isn't recording
+       *
+       * @param leftSpeed The power of the left side in percent
+       * @param rightSpeed The power of the right side in percent
+       */
+      void record(double leftSpeed, double rightSpeed);
+
+      /**
+       * @brief Loads a recording from the SD card
+       *
+       * @param fileName The name of the file
+       * @return evError No_Device_Defined if there is no SD card, Object_Does_Not_Exist if the file can't
+       *         be read, Invalid_Argument_Data if the file isn't a recording
+       */
+      evError load(const char *fileName);
+
+      /**
+       * @brief Plays back the loaded recording at the speed it was recorded. The buttons are sent through
+       *        buttonManager, so its subscribers run the same as in driver control. Returns once the
+       *        recording is done, or once autonomous ends
+       *
+       * @param correctHeading True to turn the robot toward the recorded heading while it drives, which
+       *                       keeps small differences from adding up over the run
+       * @return evError No_Data_Defined if there is no recording, Object_State_Is_Changing if the
+       *         recorder is recording
+       */
+      evError replay(bool correctHeading = true);
+
+      /**
+       * @brief Stops a replay that is running in another thread, and gives the buttons back to the
+       *        controller. Also cleans up a replay whose thread was stopped before it could finish
+       */
+      void stopReplay();
+
+      /**
+       * @brief Set how strongly a replay turns toward the recorded heading
+       *
+       * @param kp Percent power added to each side per degree of error
+       */
+      void setHeadingCorrection(double kp);
+
+      bool isRecording() { return recording; }
+      bool isReplaying() { return replaying; }
+
+      /**
+       * @return uint32_t The amount of records recorded or loaded
+       */
+      uint32_t getRecordCount() { return recordCount; }
+
+      /**
+       * @return uint32_t The length of the recording in msec
+       */
+      uint32_t getDuration() { return duration; }
+
+    private:
+      /**
+       * @brief Adds a record if there is room
+       *
+       * @param newRecord The record to add
+       */
+      void addRecord(const driverRecord &newRecord);
+
+      Drive * drivetrain;
+      driverRecord * records = nullptr;  // created the first time it is needed
+      uint32_t recordCount = 0;
+      uint32_t duration = 0;  // msec from the first record to the last
+      uint32_t lastRecordTime = 0;  // system time of the last record in msec
+      driverRecord lastRecord = {};  // last record that was added
+      volatile bool recording = false;
+      volatile bool replaying = false;
+      double headingKP = DRIVER_REPLAY_DEFAULT_KP;
+  };
+}
+
+#endif // DRIVERRECORDER_H_
@@ -0,0 +1,100 @@
+#ifndef INPUTSHAPER_H_
+#define INPUTSHAPER_H_
+
+#include <math.h>
+
+#define INPUT_SHAPER_TABLE_SIZE 201  // one entry for each percent from -100 to 100
+
+namespace evAPI {
+  enum class inputCurve {
+    Linear = 0,  // output matches the input
+    Expo,  // exponential curve, strength is the exponent rate (around 1 to 5)
+    Cubic  // blend of a line and a cubic, strength is the amount of cubic (0 to 1)
+  };
+
+  class InputShaper {
+    public:
+      /**
+       * @brief Construct a new Input Shaper object with no deadband and a linear curve
+       */
+      InputShaper();
+
+      /**
+       * @brief Set the deadband
+       * 
+       * @param deadbandIN Inputs smaller than this percent are set to 0. The rest of the stick is
+       *                   stretched so the output still starts at 0 and reaches 100
+       */
+      void setDeadband(double deadbandIN);
+
+      /**
+       * @brief Set the curve that maps the stick to the output
+       * 
+       * @param curveIN The type of curve
+       * @param strengthIN How strong the curve is. See inputCurve for the range of each curve
+       */
+      void setCurve(inputCurve curveIN, double strengthIN);
+
+      double getDeadband() { return deadband; }
+      inputCurve getCurve() { return curve; }
+      double getStrength() { return strength; }
+
+      /**
+       * @brief Shapes a stick input with the lookup table
+       * 
+       * @param input The stick position from -100 to 100 percent
+       * @return double The shaped output from -100 to 100 percent
+       */
+      double shape(double input) {
+        int index = (int)lround(input) + 100;
+        if(index < 0) index = 0;
+        if(index >= INPUT_SHAPER_TABLE_SIZE) index = INPUT_SHAPER_TABLE_SIZE - 1;
+        return table[index];
+      }
+
+    private:
+      /**
+       * @brief Fills the lookup table. Only run when the settings change
+       */
+      void buildTable();
+
+      float table[INPUT_SHAPER_TABLE_SIZE];  // output for each input percent
+      double deadband = 0;
+      inputCurve curve = inputCurve::Linear;
+      double strength = 0;
+  };
+
+  class SlewLimiter {
+    public:
+      /**
+       * @brief Set the slew rate
+       * 
+       * @param rateIN The most the output can change each second in percent. 0 turns off the limit
+       */
+      void setRate(double rateIN);
+
+      /**
+       * @brief Moves the output toward a target, no faster than the slew rate
+       * 
+       * @param target The value the output should be
+       * @param loopTime The time since the last update in seconds
+       * @return double The limited output
+       */
+      double update(double target, double loopTime);
+
+      /**
+       * @brief Sets the output right away without limiting it
+       * 
+       * @param value The new output
+       */
+      void reset(double value = 0);
+
+      double getRate() { return rate; }
+
+    private:
+      double rate = 0;
+      double output = 0;
+  };
+}
+
+#endif // INPUTSHAPER_H_
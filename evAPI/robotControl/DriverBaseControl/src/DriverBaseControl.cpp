@@ -1,6 +1,9 @@
 #include "../include/DriverBaseControl.h"
 
 namespace evAPI {
+  //Objects with a driver thread running, so the controller events can reach them
+  static DriverBaseControl *driverThreadList[DRIVER_THREAD_MAX_COUNT];
+
   /**
    * @brief Construct a new Driver Control object
    * 
@@ -12,6 +15,7 @@ namespace evAPI {
     vexController = controllerIN;
     driverType = driveTypeIN;
     drivetrain = drivetrainIN;
+    headingPID.setConstants(2, 0, 6);
   }
 
   /**
@@ -37,58 +41,457 @@ namespace evAPI {
     primaryStick = primaryStickIN;
   }
 
+  /**
+   * @brief Change the type of controlling that will be used
+   * 
+   * @param driveTypeIN The type of controlling that will be used
+   */
+  void DriverBaseControl::setDriveMode(driveMode driveTypeIN) {
+    //*start ServoSteering from the heading the robot is facing
+    if(driveTypeIN == ServoSteering && driverType != ServoSteering) {
+      lastServoTime = 0;
+    }
+
+    driverType = driveTypeIN;
+  }
+
+  driveMode DriverBaseControl::getDriveMode() {
+    return driverType;
+  }
+
+  /**
+   * @brief Set the constants of the PID that holds the heading in ServoSteering
+   * 
+   * @param kp The KP factor
+   * @param ki The KI factor
+   * @param kd The KD factor
+   */
+  void DriverBaseControl::setupHeadingPID(double kp, double ki, double kd) {
+    headingPID.setConstants(kp, ki, kd);
+  }
+
+  /**
+   * @brief Set how the stick sets the target heading in ServoSteering
+   * 
+   * @param mode The steering mode
+   */
+  void DriverBaseControl::setSteeringMode(steeringMode mode) {
+    steering = mode;
+    resetHeadingTarget();
+  }
+
+  /**
+   * @brief Set how fast the target heading turns at full stick in the Rate steering mode
+   * 
+   * @param rate The turn rate in degrees per second
+   */
+  void DriverBaseControl::setMaxTurnRate(double rate) {
+    maxTurnRate = fabs(rate);
+  }
+
+  /**
+   * @brief Hold the heading the robot is facing now
+   * 
+   */
+  void DriverBaseControl::resetHeadingTarget() {
+    targetHeading = drivetrain->getHeading();
+    referenceHeading = targetHeading;
+    headingPID.setTotalError(0);
+  }
+
+  double DriverBaseControl::getHeadingTarget() {
+    return targetHeading;
+  }
+
+  /**
+   * @brief Set the deadband and curve of the drive stick
+   * 
+   * @param deadband Inputs smaller than this percent are ignored
+   * @param curve The curve that maps the stick to the motor power
+   * @param strength How strong the curve is
+   */
+  void DriverBaseControl::setDriveShaping(double deadband, inputCurve curve, double strength) {
+    driveShaper.setDeadband(deadband);
+    driveShaper.setCurve(curve, strength);
+  }
+
+  /**
+   * @brief Set the deadband and curve of the turn stick
+   * 
+   * @param deadband Inputs smaller than this percent are ignored
+   * @param curve The curve that maps the stick to the motor power
+   * @param strength How strong the curve is
+   */
+  void DriverBaseControl::setTurnShaping(double deadband, inputCurve curve, double strength) {
+    turnShaper.setDeadband(deadband);
+    turnShaper.setCurve(curve, strength);
+  }
+
+  /**
+   * @brief Set the slew rate of each side of the base
+   * 
+   * @param rate The most the power of a side can change each second in percent
+   */
+  void DriverBaseControl::setSlewRate(double rate) {
+    leftSlew.setRate(rate);
+    rightSlew.setRate(rate);
+  }
+
+  /**
+   * @brief Reload callback for the config store
+   * 
+   * @param driverControlObject A pointer to a DriverBaseControl object
+   */
+  void driverConfigReload(void *driverControlObject) {
+    DriverBaseControl *driverControl = (DriverBaseControl*)driverControlObject;
+    ConfigStore *config = driverControl->config;
+    InputShaper &drive = driverControl->driveShaper;
+    InputShaper &turn = driverControl->turnShaper;
+
+    driverControl->setHandicaps(config->getNumber("driver.driveHandicap", driverControl->driveHandicap),
+                                config->getNumber("driver.turnHandicap", driverControl->turnHandicap));
+    driverControl->setDriveShaping(config->getNumber("driver.driveDeadband", drive.getDeadband()),
+                                   (inputCurve)config->getInt("driver.driveCurve", (int)drive.getCurve()),
+                                   config->getNumber("driver.driveCurveStrength", drive.getStrength()));
+    driverControl->setTurnShaping(config->getNumber("driver.turnDeadband", turn.getDeadband()),
+                                  (inputCurve)config->getInt("driver.turnCurve", (int)turn.getCurve()),
+                                  config->getNumber("driver.turnCurveStrength", turn.getStrength()));
+    driverControl->setSlewRate(config->getNumber("driver.slewRatePerSec", driverControl->leftSlew.getRate()));
+    driverControl->steering = (steeringMode)config->getInt("driver.steeringMode", (int)driverControl->steering);
+    driverControl->setMaxTurnRate(config->getNumber("driver.maxTurnRate", driverControl->maxTurnRate));
+    driverControl->headingPID.loadConfig(*config, "driver.headingPID");
+  }
+
+  /**
+   * @brief Loads the handicaps from a config store
+   * 
+   * @param config The config store to read from
+   * @return evError Range_Limit_Reached if the config store can't take another reload callback
+   */
+  evError DriverBaseControl::useConfig(ConfigStore &config) {
+    this->config = &config;
+    driverConfigReload(this);
+    return config.addReloadCallback(driverConfigReload, this);
+  }
+
+  /**
+   * @brief Finds the shortest angle from one heading to another
+   * 
+   * @param target The heading to turn to in degrees
+   * @param current The heading the robot is facing in degrees
+   * @return double The angle from -180 to 180 degrees. Positive to turn right
+   */
+  static double headingError(double target, double current) {
+    double error = fmod(target - current, 360);
+    if(error > 180) error -= 360;
+    if(error < -180) error += 360;
+    return error;
+  }
+
+  /**
+   * @brief Finds the powers of each side for ServoSteering
+   * 
+   * @param driveInput The forward stick position in percent
+   * @param turnInput The side to side stick position in percent
+   * @param loopTime The time since the last driverLoop in seconds
+   * @param leftSpeed Set to the power of the left side
+   * @param rightSpeed Set to the power of the right side
+   */
+  void DriverBaseControl::servoSteer(double driveInput, double turnInput, double loopTime, double &leftSpeed, double &rightSpeed) {
+    uint32_t currentTime = vex::timer::system();
+    double heading = drivetrain->getHeading();
+    double drive;
+
+    //*hold the current heading when the mode starts or the loop was paused
+    if(lastServoTime == 0 || currentTime - lastServoTime > SERVO_RESTART_TIME) {
+      resetHeadingTarget();
+    }
+    lastServoTime = currentTime;
+
+    //*move the target heading with the stick
+    switch (steering) {
+      default:
+      case steeringMode::Rate: {
+        drive = driveShaper.shape(driveInput) * driveHandicap;
+        targetHeading += (turnShaper.shape(turnInput) / 100) * maxTurnRate * loopTime;
+
+        //keep the target close to the robot so it stops turning soon after the stick is released
+        double lead = headingError(targetHeading, heading);
+        if(lead > SERVO_MAX_LEAD) targetHeading = heading + SERVO_MAX_LEAD;
+        if(lead < -SERVO_MAX_LEAD) targetHeading = heading - SERVO_MAX_LEAD;
+        break;
+      }
+      case steeringMode::Absolute:
+        drive = driveShaper.shape(driveInput) * driveHandicap;
+        targetHeading = referenceHeading + (turnShaper.shape(turnInput) / 100) * SERVO_ABSOLUTE_RANGE;
+        break;
+      case steeringMode::FieldCentric: {
+        double power = driveShaper.shape(fmin(hypot(driveInput, turnInput), 100));
+        drive = 0;
+
+        //the last direction is held when the stick is released
+        if(power != 0) {
+          targetHeading = atan2(turnInput, driveInput) * (180 / M_PI);
+
+          //drive backward if the back of the robot is closer to the direction, and slow down while turning
+          double error = headingError(targetHeading, heading);
+          if(fabs(error) > 90) {
+            targetHeading += 180;
+            power = -power;
+            error = headingError(targetHeading, heading);
+          }
+          drive = power * cos(error * (M_PI / 180)) * driveHandicap;
+        }
+        break;
+      }
+    }
+    targetHeading = fmod(targetHeading + 360, 360);
+
+    //*turn toward the target heading. The PID is tuned for the longest time between driver thread loops
+    double turn = headingPID.compute(headingError(targetHeading, heading), loopTime / (DRIVER_THREAD_MAX_PERIOD / 1000.0));
+    double maxTurn = 100 * turnHandicap;
+    if(turn > maxTurn) turn = maxTurn;
+    if(turn < -maxTurn) turn = -maxTurn;
+
+    //*scale both sides together so the robot keeps turning at full power
+    leftSpeed = drive + turn;
+    rightSpeed = drive - turn;
+    double largestSpeed = fmax(fabs(leftSpeed), fabs(rightSpeed));
+    if(largestSpeed > 100) {
+      leftSpeed *= 100 / largestSpeed;
+      rightSpeed *= 100 / largestSpeed;
+    }
+  }
+
   /**
    * @brief Called in the main driver contorl loop to drive the base
    * 
    */
   void DriverBaseControl::driverLoop() {
-    int leftSpeed;
-    int rightSpeed;
+    profiler.beginLoop();
+    double leftSpeed;
+    double rightSpeed;
+    double driveInput = 0;
+    double turnInput = 0;
+
+    //*time since the last loop, since the driver thread runs it whenever the controller sends new data
+    uint64_t currentTime = vex::timer::systemHighResolution();
+    double loopTime = DRIVER_THREAD_MAX_PERIOD / 1000.0;
+    if(lastLoopTime != 0 && currentTime - lastLoopTime < DRIVER_MAX_LOOP_TIME * 1000) {
+      loopTime = (currentTime - lastLoopTime) / 1000000.0;
+    }
+    lastLoopTime = currentTime;
+
+    //*read the sticks for the drive type
     switch (driverType) {
       case Arcade:
+      case NormalizedArcade:
+      case ServoSteering:
         switch (primaryStick) {
           case leftStick:
-            leftSpeed = (vexController->Axis3.position(vex::pct) * driveHandicap +
-                         vexController->Axis4.position(vex::pct) * turnHandicap);
-            rightSpeed = (vexController->Axis3.position(vex::pct) * driveHandicap -
-                          vexController->Axis4.position(vex::pct) * turnHandicap);
+            driveInput = vexController->Axis3.position(vex::pct);
+            turnInput = vexController->Axis4.position(vex::pct);
             break;
           case rightStick:
-            leftSpeed = (vexController->Axis2.position(vex::pct) * driveHandicap +
-                         vexController->Axis1.position(vex::pct) * turnHandicap);
-            rightSpeed = (vexController->Axis1.position(vex::pct) * driveHandicap -
-                          vexController->Axis4.position(vex::pct) * turnHandicap);
+            driveInput = vexController->Axis2.position(vex::pct);
+            turnInput = vexController->Axis1.position(vex::pct);
             break;
         }
         break;
       default:
       case Tank:
-        leftSpeed = vexController->Axis3.position(vex::pct);
-        rightSpeed = vexController->Axis2.position(vex::pct);
         break;
       case RCControl:
+      case Curvature:
         switch (primaryStick) {
           case leftStick:
-            leftSpeed = (vexController->Axis3.position(vex::pct) * driveHandicap +
-                         vexController->Axis1.position(vex::pct) * turnHandicap);
-            rightSpeed = (vexController->Axis3.position(vex::pct) * driveHandicap -
-                          vexController->Axis1.position(vex::pct) * turnHandicap);
+            driveInput = vexController->Axis3.position(vex::pct);
+            turnInput = vexController->Axis1.position(vex::pct);
             break;
           case rightStick:
-            leftSpeed = (vexController->Axis2.position(vex::pct) * driveHandicap +
-                         vexController->Axis4.position(vex::pct) * turnHandicap);
-            rightSpeed = (vexController->Axis2.position(vex::pct) * driveHandicap -
-                          vexController->Axis4.position(vex::pct) * turnHandicap);
+            driveInput = vexController->Axis2.position(vex::pct);
+            turnInput = vexController->Axis4.position(vex::pct);
             break;
         }
         break;
     }
+
+    //*shape the sticks with the lookup tables and mix them into side powers. ServoSteering needs the
+    //*heading, so it drives like arcade if there is no inertial sensor
+    if(driverType == ServoSteering && drivetrain->hasHeadingSensor()) {
+      servoSteer(driveInput, turnInput, loopTime, leftSpeed, rightSpeed);
+    } else if(driverType == Arcade || driverType == RCControl || driverType == NormalizedArcade || driverType == Curvature ||
+              driverType == ServoSteering) {
+      double drive = driveShaper.shape(driveInput) * driveHandicap;
+      double turn = turnShaper.shape(turnInput) * turnHandicap;
+
+      //*curvature mode scales the turn with the speed so the stick sets the curve. Below the quick turn
+      //*threshold it blends toward the full turn, so the robot turns in place without a jump in power
+      if(driverType == Curvature) {
+        double speed = fabs(drive);
+        if(speed >= CURVATURE_QUICK_TURN_THRESHOLD) {
+          turn *= speed / 100;
+        } else {
+          double blend = speed / CURVATURE_QUICK_TURN_THRESHOLD;  // 0 when stopped, 1 at the threshold
+          turn *= (1 - blend) + blend * (CURVATURE_QUICK_TURN_THRESHOLD / 100.0);
+        }
+      }
+
+      leftSpeed = drive + turn;
+      rightSpeed = drive - turn;
+
+      //*scale both sides together so the turn ratio is kept at full power
+      if(driverType == NormalizedArcade || driverType == Curvature) {
+        double largestSpeed = fmax(fabs(leftSpeed), fabs(rightSpeed));
+        if(largestSpeed > 100) {
+          leftSpeed *= 100 / largestSpeed;
+          rightSpeed *= 100 / largestSpeed;
+        }
+      }
+    } else {
+      leftSpeed = driveShaper.shape(vexController->Axis3.position(vex::pct));
+      rightSpeed = driveShaper.shape(vexController->Axis2.position(vex::pct));
+    }
     
     if(leftSpeed > 100) leftSpeed = 100;
     if(leftSpeed < -100) leftSpeed = -100;
     if(rightSpeed > 100) rightSpeed = 100;
     if(rightSpeed < -100) rightSpeed = -100;
 
-    drivetrain->spinBase(leftSpeed, rightSpeed);
+    //*limit how fast each side can change so the robot doesn't tip
+    leftSpeed = leftSlew.update(leftSpeed, loopTime);
+    rightSpeed = rightSlew.update(rightSpeed, loopTime);
+
+    if(recorder != nullptr) recorder->record(leftSpeed, rightSpeed);
+
+    drivetrain->spinBase(lround(leftSpeed), lround(rightSpeed));
+    profiler.endLoop();
+  }
+
+  /**
+   * @brief Controller callback that marks new stick positions for every driver thread
+   * 
+   */
+  void driverInputChanged() {
+    uint64_t currentTime = vex::timer::systemHighResolution();
+
+    for(int i = 0; i < DRIVER_THREAD_MAX_COUNT; i++) {
+      if(driverThreadList[i] != nullptr && driverThreadList[i]->inputTime == 0) {
+        driverThreadList[i]->inputTime = currentTime;
+      }
+    }
+  }
+
+  /**
+   * @brief Runs driverLoop when the controller sends new data
+   * 
+   * @param driverControlObject A pointer to a DriverBaseControl object
+   * @return int 0
+   */
+  int driverThreadFunction(void *driverControlObject) {
+    DriverBaseControl *driverControl = (DriverBaseControl*)driverControlObject;
+    uint32_t lastRunTime = 0;
+    bool wasDriving = false;  // true if the thread drove the base last time it checked
+
+    while(true) {
+      uint32_t currentTime = vex::timer::system();
+      uint64_t sampleTime = driverControl->inputTime;
+
+      if(getCompetitionStatus() != robotMode::driverControl || driverControl->paused) {
+        //*don't count the time spent stopped as a loop
+        driverControl->profiler.stop();
+        driverControl->inputTime = 0;
+        wasDriving = false;
+      } else if(sampleTime != 0 || currentTime - lastRunTime >= DRIVER_THREAD_MAX_PERIOD) {
+        //*drive as soon as new data arrives, and keep the slew and heading hold running when it doesn't
+        driverControl->inputTime = 0;
+
+        //*the base was stopped or driven by something else, so the slew starts again from stopped
+        if(!wasDriving) {
+          driverControl->leftSlew.reset();
+          driverControl->rightSlew.reset();
+          driverControl->lastLoopTime = 0;
+          wasDriving = true;
+        }
+
+        taskManager.beginWork(driverControl->driverTaskID);
+        driverControl->driverLoop();
+        taskManager.endWork(driverControl->driverTaskID);
+        lastRunTime = currentTime;
+
+        if(sampleTime != 0) {
+          driverControl->inputLatency = (vex::timer::systemHighResolution() - sampleTime) / 1000.0;
+        }
+      }
+
+      vex::this_thread::sleep_for(DRIVER_THREAD_POLL_TIME);
+    }
+
+    return 0;
+  }
+
+  /**
+   * @brief Starts a thread that runs driverLoop as soon as the controller sends new stick positions
+   * 
+   * @return evError Data_Already_Exists if the thread is already running, Range_Limit_Reached if too
+   *         many driver threads are running
+   */
+  evError DriverBaseControl::startThread() {
+    if(driverThread != nullptr) {
+      return evError::Data_Already_Exists;
+    }
+
+    //*add the object to the list the controller events are sent to
+    int listID = -1;
+    for(int i = 0; i < DRIVER_THREAD_MAX_COUNT; i++) {
+      if(driverThreadList[i] == nullptr) {
+        listID = i;
+        break;
+      }
+    }
+    if(listID == -1) {
+      return evError::Range_Limit_Reached;
+    }
+    driverThreadList[listID] = this;
+
+    //*the controller sends data on its own schedule, so the sticks are watched for changes
+    vexController->Axis1.changed(driverInputChanged);
+    vexController->Axis2.changed(driverInputChanged);
+    vexController->Axis3.changed(driverInputChanged);
+    vexController->Axis4.changed(driverInputChanged);
+
+    driverThread = new vex::thread(driverThreadFunction, this);
+    driverTaskID = taskManager.addTask(driverThread, taskRole::Driver, "Driver Base");
+    return evError::No_Error;
+  }
+
+  /**
+   * @brief Stops the driver thread from moving the base
+   * 
+   * @param pause True to stop the thread from moving the base
+   */
+  void DriverBaseControl::setPaused(bool pause) {
+    paused = pause;
+  }
+
+  bool DriverBaseControl::isPaused() {
+    return paused;
+  }
+
+  double DriverBaseControl::getInputLatency() {
+    return inputLatency;
+  }
+
+  /**
+   * @brief Sends the side powers from each driverLoop to a recorder
+   * 
+   * @param recorderIN The recorder. Set to nullptr to stop sending the powers
+   */
+  void DriverBaseControl::setRecorder(DriverRecorder * recorderIN) {
+    recorder = recorderIN;
+  }
+
+  LoopProfiler& DriverBaseControl::getProfiler() {
+    return profiler;
   }
 }
\ No newline at end of file
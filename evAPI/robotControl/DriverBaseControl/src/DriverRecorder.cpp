@@ -0,0 +1,273 @@
+#include <string.h>
+#include "../include/DriverRecorder.h"
+#include "../../../Common/include/generalFunctions.h"
+
+namespace evAPI {
+  /**
+   * @brief Construct a new Driver Recorder object
+   *
+   * @param drivetrainIN The drivetrain the powers are recorded from and replayed on
+   */
+  DriverRecorder::DriverRecorder(Drive * drivetrainIN) {
+    drivetrain = drivetrainIN;
+  }
+
+  DriverRecorder::~DriverRecorder() {
+    delete[] records;
+  }
+
+  /**
+   * @brief Clears the records and starts recording
+   *
+   * @return evError Object_State_Is_Changing if a recording is being replayed
+   */
+  evError DriverRecorder::startRecording() {
+    if(replaying) {
+      return evError::Object_State_Is_Changing;
+    }
+
+    if(records == nullptr) {
+      records = new driverRecord[DRIVER_RECORD_MAX_COUNT];
+    }
+
+    recordCount = 0;
+    duration = 0;
+    recording = true;
+    return evError::No_Error;
+  }
+
+  /**
+   * @brief Stops recording and saves the records to the SD card
+   *
+   * @param fileName The name of the file
+   * @return evError No_Data_Defined if nothing was recorded, No_Device_Defined if there is no SD card,
+   *         Unknown_Error if the file couldn't be written
+   */
+  evError DriverRecorder::stopRecording(const char *fileName) {
+    recording = false;
+
+    if(recordCount == 0) {
+      return evError::No_Data_Defined;
+    }
+
+    if(!Brain.SDcard.isInserted()) {
+      return evError::No_Device_Defined;
+    }
+
+    //*write the header, then the records right after it
+    driverRecordHeader header;
+    memcpy(header.magic, "DRVR", 4);
+    header.version = DRIVER_RECORD_VERSION;
+    header.recordSize = sizeof(driverRecord);
+    header.recordCount = recordCount;
+
+    if(Brain.SDcard.savefile(fileName, (uint8_t *)&header, sizeof(header)) != sizeof(header)) {
+      return evError::Unknown_Error;
+    }
+
+    int32_t recordsSize = recordCount * sizeof(driverRecord);
+    if(Brain.SDcard.appendfile(fileName, (uint8_t *)records, recordsSize) != recordsSize) {
+      return evError::Unknown_Error;
+    }
+
+    return evError::No_Error;
+  }
+
+  /**
+   * @brief Adds a record if there is room
+   *
+   * @param newRecord The record to add
+   */
+  void DriverRecorder::addRecord(const driverRecord &newRecord) {
+    if(recordCount >= DRIVER_RECORD_MAX_COUNT) {
+      return;
+    }
+
+    records[recordCount] = newRecord;
+    recordCount++;
+    duration += newRecord.timeChange;
+    lastRecord = newRecord;
+  }
+
+  /**
+   * @brief Adds the powers from one loop of driver control to the recording
+   *
+   * @param leftSpeed The power of the left side in percent
+   * @param rightSpeed The power of the right side in percent
+   */
+  void DriverRecorder::record(double leftSpeed, double rightSpeed) {
+    if(!recording) {
+      return;
+    }
+
+    uint32_t currentTime = vex::timer::system();
+    uint32_t timeChange = recordCount == 0 ? 0 : currentTime - lastRecordTime;
+
+    driverRecord newRecord;
+    newRecord.leftPower = (int8_t)lround(leftSpeed);
+    newRecord.rightPower = (int8_t)lround(rightSpeed);
+    newRecord.buttons = buttonManager.getHeld(vex::controllerType::primary);
+    newRecord.heading = (uint16_t)(lround(drivetrain->getHeading() * 100) % 36000);
+
+    //*only save changes, plus a keyframe every so often to keep the heading
+    if(recordCount != 0 && timeChange < DRIVER_RECORD_KEYFRAME_TIME && newRecord.leftPower == lastRecord.leftPower &&
+       newRecord.rightPower == lastRecord.rightPower && newRecord.buttons == lastRecord.buttons) {
+      return;
+    }
+
+    newRecord.timeChange = timeChange > UINT16_MAX ? UINT16_MAX : timeChange;
+    addRecord(newRecord);
+    lastRecordTime = currentTime;
+  }
+
+  /**
+   * @brief Loads a recording from the SD card
+   *
+   * @param fileName The name of the file
+   * @return evError No_Device_Defined if there is no SD card, Object_Does_Not_Exist if the file can't
+   *         be read, Invalid_Argument_Data if the file isn't a recording
+   */
+  evError DriverRecorder::load(const char *fileName) {
+    if(recording || replaying) {
+      return evError::Object_State_Is_Changing;
+    }
+
+    if(!Brain.SDcard.isInserted()) {
+      return evError::No_Device_Defined;
+    }
+
+    //*read the file straight into the record buffer, then move the records to the start of it
+    if(records == nullptr) {
+      records = new driverRecord[DRIVER_RECORD_MAX_COUNT];
+    }
+    int32_t maxSize = DRIVER_RECORD_MAX_COUNT * sizeof(driverRecord);
+    int32_t length = Brain.SDcard.loadfile(fileName, (uint8_t *)records, maxSize);
+
+    recordCount = 0;
+    duration = 0;
+
+    if(length < (int32_t)sizeof(driverRecordHeader)) {
+      return evError::Object_Does_Not_Exist;
+    }
+
+    driverRecordHeader header;
+    memcpy(&header, records, sizeof(header));
+    if(memcmp(header.magic, "DRVR", 4) != 0 || header.version != DRIVER_RECORD_VERSION ||
+       header.recordSize != sizeof(driverRecord)) {
+      return evError::Invalid_Argument_Data;
+    }
+
+    //the header takes the place of some records, so a full file can't fit
+    uint32_t count = (length - sizeof(header)) / sizeof(driverRecord);
+    if(header.recordCount < count) count = header.recordCount;
+    memmove(records, (uint8_t *)records + sizeof(header), count * sizeof(driverRecord));
+
+    for(uint32_t i = 0; i < count; i++) {
+      duration += records[i].timeChange;
+    }
+    recordCount = count;
+
+    return evError::No_Error;
+  }
+
+  /**
+   * @brief Wraps an angle to the shortest turn
+   *
+   * @param angle The angle in degrees
+   * @return double The angle from -180 to 180 degrees
+   */
+  static double wrapHeading(double angle) {
+    angle = fmod(angle, 360);
+    if(angle > 180) angle -= 360;
+    if(angle < -180) angle += 360;
+    return angle;
+  }
+
+  /**
+   * @brief Plays back the loaded recording at the speed it was recorded. Stops early once autonomous ends
+   *
+   * @param correctHeading True to turn the robot toward the recorded heading while it drives
+   * @return evError No_Data_Defined if there is no recording, Object_State_Is_Changing if the
+   *         recorder is recording
+   */
+  evError DriverRecorder::replay(bool correctHeading) {
+    if(recording || replaying) {
+      return evError::Object_State_Is_Changing;
+    }
+
+    if(recordCount == 0) {
+      return evError::No_Data_Defined;
+    }
+
+    replaying = true;
+
+    //*the recorded headings are used relative to the heading the robot starts at
+    double headingOffset = drivetrain->getHeading() - records[0].heading / 100.0;
+
+    uint32_t startTime = vex::timer::system();
+    uint32_t recordTime = 0;  // msec from the start to the record being played
+    uint32_t nextRecord = 0;
+    driverRecord currentRecord = records[0];
+
+    //the thread running autonomous is stopped when the mode changes, so the replay is ended before then
+    while(replaying && nextRecord < recordCount && getCompetitionStatus() == robotMode::autonomousControl) {
+      uint32_t elapsedTime = vex::timer::system() - startTime;
+
+      //*move to the newest record that has been reached
+      while(nextRecord < recordCount && recordTime + records[nextRecord].timeChange <= elapsedTime) {
+        recordTime += records[nextRecord].timeChange;
+        currentRecord = records[nextRecord];
+        nextRecord++;
+        buttonManager.replaceButtons(vex::controllerType::primary, currentRecord.buttons);
+      }
+
+      double leftSpeed = currentRecord.leftPower;
+      double rightSpeed = currentRecord.rightPower;
+
+      //*turn toward the recorded heading while the robot is moving
+      if(correctHeading && (leftSpeed != 0 || rightSpeed != 0)) {
+        double targetHeading = currentRecord.heading / 100.0 + headingOffset;
+
+        //the heading is only saved with each record, so the heading between records is estimated
+        if(nextRecord < recordCount && records[nextRecord].timeChange != 0) {
+          double headingChange = wrapHeading(records[nextRecord].heading / 100.0 - currentRecord.heading / 100.0);
+          targetHeading += headingChange * (elapsedTime - recordTime) / records[nextRecord].timeChange;
+        }
+
+        double error = wrapHeading(targetHeading - drivetrain->getHeading());
+
+        leftSpeed += error * headingKP;
+        rightSpeed -= error * headingKP;
+        if(leftSpeed > 100) leftSpeed = 100;
+        if(leftSpeed < -100) leftSpeed = -100;
+        if(rightSpeed > 100) rightSpeed = 100;
+        if(rightSpeed < -100) rightSpeed = -100;
+      }
+
+      drivetrain->spinBase(lround(leftSpeed), lround(rightSpeed));
+      vex::this_thread::sleep_for(DRIVER_REPLAY_LOOP_TIME);
+    }
+
+    drivetrain->stopRobot();
+    buttonManager.restoreButtons(vex::controllerType::primary);
+    replaying = false;
+    return evError::No_Error;
+  }
+
+  /**
+   * @brief Stops a replay that is running in another thread, and gives the buttons back to the controller
+   */
+  void DriverRecorder::stopReplay() {
+    replaying = false;
+    buttonManager.restoreButtons(vex::controllerType::primary);
+  }
+
+  /**
+   * @brief Set how strongly a replay turns toward the recorded heading
+   *
+   * @param kp Percent power added to each side per degree of error
+   */
+  void DriverRecorder::setHeadingCorrection(double kp) {
+    headingKP = kp;
+  }
+}
@@ -0,0 +1,107 @@
+#include "../include/InputShaper.h"
+
+namespace evAPI {
+  /**
+   * @brief Construct a new Input Shaper object with no deadband and a linear curve
+   */
+  InputShaper::InputShaper() {
+    buildTable();
+  }
+
+  /**
+   * @brief Set the deadband
+   * 
+   * @param deadbandIN Inputs smaller than this percent are set to 0
+   */
+  void InputShaper::setDeadband(double deadbandIN) {
+    if(deadbandIN < 0) deadbandIN = 0;
+    if(deadbandIN > 99) deadbandIN = 99;
+    deadband = deadbandIN;
+    buildTable();
+  }
+
+  /**
+   * @brief Set the curve that maps the stick to the output
+   * 
+   * @param curveIN The type of curve
+   * @param strengthIN How strong the curve is
+   */
+  void InputShaper::setCurve(inputCurve curveIN, double strengthIN) {
+    curve = curveIN;
+    strength = strengthIN;
+    buildTable();
+  }
+
+  /**
+   * @brief Fills the lookup table. Only run when the settings change
+   */
+  void InputShaper::buildTable() {
+    for(int i = 0; i < INPUT_SHAPER_TABLE_SIZE; i++) {
+      int input = i - 100;
+      double size = input < 0 ? -input : input;
+
+      //*remove the deadband and stretch the rest of the stick to 0 to 1
+      if(size <= deadband) {
+        table[i] = 0;
+        continue;
+      }
+      double x = (size - deadband) / (100 - deadband);
+
+      //*apply the curve
+      double y;
+      switch (curve) {
+        case inputCurve::Expo:
+          y = strength > 0 ? (exp(strength * x) - 1) / (exp(strength) - 1) : x;
+          break;
+        case inputCurve::Cubic:
+          y = strength * x * x * x + (1 - strength) * x;
+          break;
+        default:
+        case inputCurve::Linear:
+          y = x;
+          break;
+      }
+
+      table[i] = (input < 0 ? -y : y) * 100;
+    }
+  }
+
+  /**
+   * @brief Set the slew rate
+   * 
+   * @param rateIN The most the output can change each second in percent
+   */
+  void SlewLimiter::setRate(double rateIN) {
+    rate = rateIN < 0 ? 0 : rateIN;
+  }
+
+  /**
+   * @brief Moves the output toward a target, no faster than the slew rate
+   * 
+   * @param target The value the output should be
+   * @param loopTime The time since the last update in seconds
+   * @return double The limited output
+   */
+  double SlewLimiter::update(double target, double loopTime) {
+    double change = rate * loopTime;  // most the output can change this update
+    if(rate == 0) {
+      output = target;
+    } else if(target > output + change) {
+      output += change;
+    } else if(target < output - change) {
+      output -= change;
+    } else {
+      output = target;
+    }
+    return output;
+  }
+
+  /**
+   * @brief Sets the output right away without limiting it
+   * 
+   * @param value The new output
+   */
+  void SlewLimiter::reset(double value) {
+    output = value;
+  }
+}
@@ -3,8 +3,14 @@
 
 #include "../../../Common/include/generalFunctions.h"
 #include "../../../Common/include/PID.h"
+#include "../../../Common/include/TaskManager.h"
+#include "../../../Common/include/LoopProfiler.h"
 #include "../../OdoTracking/include/OdoMath.h"
+#include "../../OdoTracking/include/VelocityEstimator.h"
+#include "../../../VisionTracker/include/VisionTracker.h"
 #include "SmartEncoder.h"
+#include "MotionFaultDetector.h"
+#include "MotorHealthMonitor.h"
 
 /**
  * ! Remember to keep code well documented
@@ -19,14 +25,22 @@
  * TODO: write odometry position tracking
  * TODO: write drive to point for odometry
  * TODO: write path finding for odometry
- * TODO: integrate vision tracking
- * TODO: Add functions to get the current state of the drive base, like its velocity
  * 
 */
 
 #define DRIVE_TRACKER 0
 #define ODO_TRACKER 1
 
+#define ODO_DEFAULT_RATE 10  // default time between odo updates in msec
+#define ODO_MIN_RATE 5  // fastest rate the rotation sensors can send data in msec
+
+#define FAULT_REDUCED_POWER 0.5  // power multiplier used after a fault with the ReducePower response
+
+#define VISION_SEARCH_FRAMES 25  // frames driveToObject waits to see an object before giving up
+#define VISION_LOST_FRAMES 5  // frames in a row without the object before driveToObject switches to odometry
+#define VISION_POLL_TIME 5  // msec between checks of the vision mailbox for a new frame
+#define VISION_REACQUIRE_DISTANCE 6  // inches from the lost object a new object must be to be driven to instead
+
 namespace evAPI {
   class Drive {
     public:
@@ -219,6 +233,18 @@ namespace evAPI {
       */
       void rightEncoderSetup(int port, double wheelSize, bool reverse = false);
 
+      /**
+       * @brief Sets how often the odometry runs. The encoders are set to send data at the same rate, and
+       *        the odometry only runs when there is a new sample.
+       * @param rate The time between updates in msec. Can be as low as 5.
+      */
+      void setOdoRate(uint rate);
+
+      /**
+       * @returns The time between odometry updates in msec.
+      */
+      uint getOdoRate();
+
       /**
        * @brief Resets all position data for the left encoder.
       */
@@ -291,6 +317,63 @@ namespace evAPI {
       */
       void setupArcDriftPID(double kp, double ki, double kd, int minStopError, int timeToStop, int timeoutTime);
 
+      /**
+       * @brief Sets up the PID controller that turns toward an object in driveToObject. Defaults to a kp of
+       *        1.5, a kd of 4, and a timeout of 150 cycles.
+       * @param kp The proportional value for the PID, in percent power per degree.
+       * @param ki The integral value for the PID.
+       * @param kd The derivative value for the PID.
+       * @param minStopError The minimum error required for the PID to finish.
+       * @param timeToStop The amount of cycles the PID needs to run for with the error being less than
+       *                   minStopError for the PID to finish.
+       * @param timeoutTime The amount of cycles the PID needs to take before it times out and exits.
+      */
+      void setupVisionTurnPID(double kp, double ki, double kd, int minStopError, int timeToStop, int timeoutTime);
+
+      /**
+       * @brief Sets up the PID controller that drives up to an object in driveToObject. driveToObject
+       *        finishes when this PID settles. Defaults to a kp of 5, a kd of 10, and a timeout of 250 cycles.
+       * @param kp The proportional value for the PID, in percent power per inch.
+       * @param ki The integral value for the PID.
+       * @param kd The derivative value for the PID.
+       * @param minStopError The minimum error required for the PID to finish.
+       * @param timeToStop The amount of cycles the PID needs to run for with the error being less than
+       *                   minStopError for the PID to finish.
+       * @param timeoutTime The amount of cycles the PID needs to take before it times out and exits.
+      */
+      void setupVisionDrivePID(double kp, double ki, double kd, int minStopError, int timeToStop, int timeoutTime);
+
+      /**
+       * @brief Gets one of the PID controllers used by the drive functions. Used for live tuning.
+       * @param type The PID to get.
+       * @returns A reference to the PID.
+      */
+      PID& getPID(pidType type);
+
+      /**
+       * @returns The profiler for the odometry thread.
+      */
+      LoopProfiler& getOdoProfiler();
+
+      /**
+       * @returns The profiler for the loops in the drive functions.
+      */
+      LoopProfiler& getMotionProfiler();
+
+      /*----- config setup -----*/
+
+      /**
+       * @brief Loads the geartrain, base width, default speeds, and all PID constants from a config
+       *        store, and reloads them every time the config store is reloaded. Call this after the
+       *        other setup functions so their values are used for any keys missing from the file.
+       * @param config The config store to read from. It must exist for as long as the drive does.
+       * @returns An evError.
+       *          Range_Limit_Reached: If the config store can't take another reload callback. The values
+       *          are still loaded once.
+       *          No_Error: If the values were loaded.
+      */
+      evError useConfig(ConfigStore &config);
+
       /*----- inertial setup -----*/
 
       /**
@@ -438,6 +521,65 @@ namespace evAPI {
       */
       void arcTurn(double radius, vex::turnType direction, int angle);
 
+      /**
+       * @brief Drives up to an object seen by a vision sensor. The robot steers with the angle to the
+       *        object and drives with the distance to it, both read each frame. If the object leaves the
+       *        frame, such as when it gets too close to the sensor, the robot drives to where the object
+       *        was last seen using odometry.
+       * @param tracker The tracker of the vision sensor. The object is picked with its selection mode, and
+       *                the distance curve must be set up in inches. If its thread is running, each new
+       *                frame is read from its mailbox instead of waiting on the sensor.
+       * @param stopDistance How far from the object to stop in inches.
+       * @param speed Optional. The top speed to drive at.
+       * @returns True if the robot reached the object. False if no object was seen, the PID timed out, or a
+       *          fault stopped the robot.
+       * @warning The odometry thread must be running for the robot to keep going when the object is lost.
+      */
+      bool driveToObject(VisionTracker &tracker, double stopDistance, int speed);
+
+      /**
+       * @brief Drives up to an object seen by a vision sensor.
+       * @param tracker The tracker of the vision sensor.
+       * @param stopDistance How far from the object to stop in inches.
+       * @returns True if the robot reached the object.
+      */
+      bool driveToObject(VisionTracker &tracker, double stopDistance);
+
+      /*----- fault detection -----*/
+
+      /**
+       * @brief Sets what the drive functions do when they find a slip, stall, or collision. By default
+       *        stalls abort the drive function, slips reduce the power, and collisions are ignored.
+       * @param fault The fault to set the response for.
+       * @param response What to do when the fault is found.
+      */
+      void setFaultResponse(motionFault fault, faultResponse response);
+
+      /**
+       * @returns The last fault found by the most recent drive function. motionFault::None if there
+       *          wasn't one. Use this to re-localize after a motion was stopped early.
+      */
+      motionFault getLastFault();
+
+      /**
+       * @returns The detector used by the drive functions. Used to change the fault thresholds.
+      */
+      MotionFaultDetector& getFaultDetector();
+
+      /*----- motor health -----*/
+
+      /**
+       * @brief Starts watching the temperature and current of every base motor. The current limit of the
+       *        motors is lowered a little at a time as they heat up, so the firmware doesn't throttle them
+       *        suddenly. Call after the ports are set up.
+      */
+      void startHealthMonitor();
+
+      /**
+       * @returns The monitor that watches the base motors.
+      */
+      MotorHealthMonitor& getHealthMonitor();
+
       /*----- odo tracking -----*/
 
       /**
@@ -450,6 +592,16 @@ namespace evAPI {
        * @brief Stars the odometry thread.
       */
       void startOdoThread();
+
+      /**
+       * @returns The x position of the robot from odometry in inches.
+      */
+      double getXPosition();
+
+      /**
+       * @returns The y position of the robot from odometry in inches.
+      */
+      double getYPosition();
   
       /************ Sensors ************/
       /*----- movement -----*/
@@ -460,11 +612,43 @@ namespace evAPI {
       bool isMoving();
 
       /**
-       * @brief Gets the motor speed of the specified side.
+       * @brief Gets the motor speed of the specified side from the motor encoders.
        * @param side The side to get the speed from.
-       * @returns The speed of the motors.
+       * @returns The average speed of the motors on that side, converted to wheel speed in inches per
+       *          second.
       */
       double getMotorSpeed(vex::turnType side);
+
+      /**
+       * @brief Gets the forward speed of the robot. Updated by the odometry thread from the encoders.
+       * @returns The speed in inches per second. Negative when driving backward.
+      */
+      double getVelocity();
+
+      /**
+       * @brief Gets the speed of one side of the robot. Updated by the odometry thread from the encoders.
+       * @param side The side to get the speed from.
+       * @returns The speed in inches per second.
+      */
+      double getSideVelocity(vex::turnType side);
+
+      /**
+       * @brief Gets the turning speed of the robot. Updated by the odometry thread from the inertial
+       *        sensor.
+       * @returns The speed in degrees per second. Positive when turning right.
+      */
+      double getTurnVelocity();
+
+      /**
+       * @returns The heading of the robot from the inertial sensor in degrees, from 0 to 360. 0 if there
+       *          is no inertial sensor.
+      */
+      double getHeading();
+
+      /**
+       * @returns True if there is an inertial sensor plugged in to read the heading from.
+      */
+      bool hasHeadingSensor();
   
     private:
       /************ motors ************/
@@ -499,7 +683,7 @@ namespace evAPI {
       double rightEncoderDegsPerInch;  //degrees per inch of wheel on right encoder
 
       /****** inertial sensor ******/
-      vex::inertial * turnSensor;  //pointer to the inertial sensor 
+      vex::inertial * turnSensor = nullptr;  //pointer to the inertial sensor 
   
       /****** motor and wheel settings ******/
       bool isDebugMode = false;  //is debug mode on
@@ -512,7 +696,30 @@ namespace evAPI {
 
       /****** odo stuff ******/
       vex::thread * odoThread;  // thread used for odo tracking
+      int odoTaskID = -1;  // ID of the odo thread in the task manager
+      uint odoRate = ODO_DEFAULT_RATE;  // time between odo updates in msec
+      uint32_t lastOdoSampleTime = 0;  // time of the last encoder sample used by the odo
+      LoopProfiler odoProfiler = LoopProfiler("Odometry", ODO_DEFAULT_RATE);  // timing of the odo thread
+      LoopProfiler motionProfiler = LoopProfiler("Drive Motion", 20);  // timing of the drive function loops
       OdoMath odoTracker;  // object that runs odo math
+      double leftOdoDistance = 0;  // total distance of the left encoder in inches
+      double rightOdoDistance = 0;  // total distance of the right encoder in inches
+      double odoRotation = 0;  // total rotation of the robot in degrees
+      VelocityEstimator leftVelocity;  // filtered speed of the left side
+      VelocityEstimator rightVelocity;  // filtered speed of the right side
+      VelocityEstimator turnVelocity;  // filtered turning speed
+
+      /****** motor health ******/
+      MotorHealthMonitor baseHealth;  // watches the temperature and current of the base motors
+
+      /****** fault detection ******/
+      MotionFaultDetector faultDetector;  // finds slips, stalls, and collisions during drive functions
+      faultResponse faultResponses[4] = {faultResponse::Ignore, faultResponse::ReducePower,
+                                         faultResponse::Abort, faultResponse::Ignore};  // response to each motionFault
+      double faultPowerScale = 1;  // power multiplier for the current drive function
+      void startFaultCheck();  // resets the fault detection at the start of a drive function
+      bool checkFaults(int &moveSpeed);  // checks for faults and applies the response, returns true if the motion should end
+      double getAverageCurrent();  // returns the average current of the base motors in amps
   
       /****** drive variables ******/
       PID turnPID;
@@ -520,6 +727,8 @@ namespace evAPI {
       PID driftPID;
       PID arcPID;
       PID arcDriftPID;
+      PID visionTurnPID;
+      PID visionDrivePID;
       int driveSpeed = 80;
       int turnSpeed = 60;
       int arcTurnSpeed = 40;
@@ -555,6 +764,11 @@ namespace evAPI {
       int arcDriftMaxStopError;  //max amount of degrees to be considered "there"
       int arcDriftTimeToStop;  //how many pid cycles of being "there" till it stops
 
+      /****** config ******/
+      ConfigStore * config = nullptr;  //config store the tuning values are loaded from
+      void applyConfig(ConfigStore &config);  //reads all the values from the config store
+      friend void driveConfigReload(void *driveObject);  //reload callback for the config store
+
       /****** formulas ******/
       leftAndRight findDir(int startingAngle, int endingAngle);  //finds the direction that is faster
       int turnError(leftAndRight direction, int startAngle, int endAngle);  //finds the error of a turn
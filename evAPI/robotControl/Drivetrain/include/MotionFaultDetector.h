@@ -0,0 +1,48 @@
+#ifndef MOTIONFAULTDETECTOR_H_
+#define MOTIONFAULTDETECTOR_H_
+
+#include "../../../Common/include/evNamespace.h"
+
+#define FAULT_STARTUP_CYCLES 5  // cycles at the start of a motion that stalls and slips are ignored
+#define FAULT_CONFIRM_CYCLES 2  // cycles in a row a stall or slip has to be seen for
+
+namespace evAPI {
+  // Sensor values read once each cycle of a drive function
+  struct faultSample {
+    double power;  // power sent to the motors in percent
+    double wheelSpeed;  // speed of the powered wheels from the motor encoders in inches per second
+    double wheelForwardSpeed;  // forward speed of the center of the robot from the motor encoders in inches per second
+    double trackingSpeed;  // forward speed of the center of the robot from the tracking encoders in inches per second
+    bool hasTracking;  // true if there are tracking encoders
+    double current;  // average motor current in amps
+    double acceleration;  // sideways and forward acceleration from the inertial sensor in g
+  };
+
+  // Compares the motor encoders, tracking encoders, motor current, and inertial sensor each cycle to find
+  // slips, stalls, and collisions
+  class MotionFaultDetector {
+    public:
+      void reset();  // clears the counters at the start of a motion
+      motionFault update(const faultSample &sample);  // checks a cycle of samples and returns any fault found
+      motionFault getLastFault();  // returns the last fault found since the last reset
+
+      void setStallLimits(double minPower, double maxSpeed, double minCurrent);  // sets the values that count as a stall
+      void setSlipRatio(double ratio);  // sets how much slower than the wheels the tracking encoders have to be for a slip
+      void setCollisionAcceleration(double acceleration);  // sets the acceleration in g that counts as a collision
+
+    private:
+      int cycleCount = 0;  // cycles since the last reset
+      int stallCycles = 0;  // cycles in a row a stall was seen
+      int slipCycles = 0;  // cycles in a row a slip was seen
+      motionFault lastFault = motionFault::None;
+
+      double stallMinPower = 20;  // lowest power that can stall in percent
+      double stallMaxSpeed = 2;  // fastest wheel speed that is still a stall in inches per second
+      double stallMinCurrent = 2;  // lowest current that can stall in amps
+      double slipRatio = 0.5;  // tracking speed under this much of the wheel speed is a slip
+      double slipMinSpeed = 5;  // forward wheel speed needed to check for slips in inches per second
+      double collisionAcceleration = 1;  // acceleration that is a collision in g
+  };
+}  // namespace evAPI
+
+#endif // MOTIONFAULTDETECTOR_H_
@@ -0,0 +1,51 @@
+#ifndef MOTORHEALTHMONITOR_H_
+#define MOTORHEALTHMONITOR_H_
+
+#include "../../../Common/include/evAPIBasicConfig.h"
+#include "../../../Common/include/TaskManager.h"
+
+#define MOTOR_HEALTH_MAX_MOTORS 8
+#define MOTOR_HEALTH_SAMPLE_TIME 500  // time between samples in msec
+#define MOTOR_THROTTLE_TEMPERATURE 55  // temperature the motor firmware cuts the current in half at in celsius
+#define MOTOR_LIMIT_START_TEMPERATURE 45  // temperature the monitor starts lowering the torque at in celsius
+#define MOTOR_MAX_CURRENT 2.5  // current a V5 motor can draw before it is limited in amps
+#define MOTOR_LIMIT_MIN_CURRENT 1.25  // current limit at the throttle temperature in amps
+#define MOTOR_LIMIT_MAX_STEP 0.125  // most the current limit can change each sample in amps
+#define MOTOR_HEALTH_WARNING_TIME 30  // a warning is given when throttling is predicted within this many seconds
+
+namespace evAPI {
+  // Samples the temperature and current of a group of motors, predicts when the firmware will throttle
+  // them, and lowers their current limit a little at a time before it does
+  class MotorHealthMonitor {
+    public:
+      void addMotor(vex::motor * motor);  // adds a motor to watch
+      void update();  // samples every motor and updates the torque limit
+      void start();  // starts a thread that calls update at the sample rate
+      void setLimiting(bool enabled);  // turns the current limiting on or off
+
+      double getMaxTemperature();  // returns the temperature of the hottest motor in celsius
+      double getAverageCurrent();  // returns the average current of the motors in amps
+      double getHeatingRate();  // returns how fast the hottest motor is heating in celsius per second
+      double getTimeToThrottle();  // returns the predicted seconds until throttling, -1 if it isn't heating
+      double getCurrentLimit();  // returns the current limit set on the motors in amps
+      bool hasWarning();  // returns true if the motors are limited or will throttle soon
+
+    private:
+      vex::motor * motors[MOTOR_HEALTH_MAX_MOTORS];  // motors being watched
+      int motorCount = 0;
+      double maxTemperature = 0;  // temperature of the hottest motor
+      double averageCurrent = 0;  // average current of the motors
+      double lastTemperature = -1;  // hottest temperature at the last sample, -1 before the first sample
+      uint32_t lastSampleTime = 0;  // time of the last sample in msec
+      double heatingRate = 0;  // filtered heating rate of the hottest motor
+      double currentLimit = MOTOR_MAX_CURRENT;  // current limit set on the motors
+      bool limiting = true;  // true if the current is limited
+      vex::thread * healthThread = nullptr;  // thread that samples the motors
+      int healthTaskID = -1;  // ID of the thread in the task manager
+      friend int motorHealthThread(void *monitorObject);  // function run by the thread
+  };
+
+  int motorHealthThread(void *monitorObject);
+}  // namespace evAPI
+
+#endif // MOTORHEALTHMONITOR_H_
@@ -13,12 +13,13 @@ class SmartEncoder {
     int newTracker();  //adds a new septate tracker
     void resetTrackerPosition(int trackerID);  //resets a specified tracker
     double readTrackerPosition(int trackerID);  //reads a tracker of a specified tracker
+    uint32_t readSampleTime();  //reads the time the encoder sent its last sample in msec
 
   private:
     std::vector<double> encoderOffsets;  //stores all the offsets with to an array
     int trackerCount;  //how many encoders are being used
-    vex::motor * motorEncoder;  //pointer to vex motor
-    vex::rotation * rotationEncoder;  //pointer to vex rotation sensor
+    vex::motor * motorEncoder = nullptr;  //pointer to vex motor
+    vex::rotation * rotationEncoder = nullptr;  //pointer to vex rotation sensor
     double encoderRead();  //reads the raw encoder, motor or rotation
     void encoderReset();  //resets the encoder, motor or rotation
 };
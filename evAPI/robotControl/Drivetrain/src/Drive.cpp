@@ -7,11 +7,15 @@ namespace evAPI {
   /****** constructors ******/
   Drive::Drive( void ) {
     threadReference = this;
+    setupVisionTurnPID(1.5, 0, 4, 2, 5, 150);  // defaults so driveToObject works and times out before it is tuned
+    setupVisionDrivePID(5, 0, 10, 1, 5, 250);
   }
   
   Drive::Drive(vex::gearSetting driveGear) {
     currentGear = driveGear;
     threadReference = this;
+    setupVisionTurnPID(1.5, 0, 4, 2, 5, 150);
+    setupVisionDrivePID(5, 0, 10, 1, 5, 250);
   }
 
   /****** debug ******/
@@ -72,6 +76,7 @@ namespace evAPI {
     drivePID.setTotalError(0);
     driftPID.setTotalError(0);
     drivePID.resetTimeout();
+    driftPID.resetTimeout();
 
     //*checks to see if you have encoders and then sets the desired angle of the pid*
     if(leftEncoder) {
@@ -91,7 +96,10 @@ namespace evAPI {
     if(isDebugMode) printf("position, error, moveSpeed\n");
 
     //*main PID loop*
+    startFaultCheck();
     while(isPIDRunning) {
+      motionProfiler.beginLoop();
+
       //*get encoder positions*
       leftPosition = leftTracker->readTrackerPosition(leftDriveTracker);
       rightPosition = rightTracker->readTrackerPosition(rightDriveTracker);
@@ -109,6 +117,9 @@ namespace evAPI {
       if(moveSpeed > speed) moveSpeed = speed;
       if(moveSpeed < -speed) moveSpeed = -speed;
 
+      //*check for slips, stalls, and collisions
+      if(checkFaults(moveSpeed)) {isPIDRunning = false;}
+
       //*setting motor speeds*
       spinBase(moveSpeed - driftPower, moveSpeed + driftPower);
 
@@ -122,9 +133,12 @@ namespace evAPI {
         printf("%i\n", moveSpeed);
       }
 
+      motionProfiler.endLoop();
+
       //*wait to avoid overloading*
       vex::task::sleep(20);
     }
+    motionProfiler.stop();
     stopRobot(vex::brakeType::brake);
   }
 
@@ -163,7 +177,10 @@ namespace evAPI {
     if(isDebugMode) printf("error, moveSpeed");
 
     //*main PID loop*
+    startFaultCheck();
     while(isPIDRunning) {
+      motionProfiler.beginLoop();
+
       //*get heading*
       currentHeading = turnSensor->heading(vex::rotationUnits::deg);
 
@@ -177,6 +194,9 @@ namespace evAPI {
       if(moveSpeed > speed) moveSpeed = speed;
       if(moveSpeed < -speed) moveSpeed = -speed;
 
+      //*check for slips, stalls, and collisions
+      if(checkFaults(moveSpeed)) {isPIDRunning = false;}
+
       //*setting motor speeds*
       if(turnDirection == LEFT) {
         spinBase(-moveSpeed, moveSpeed);
@@ -193,9 +213,12 @@ namespace evAPI {
         printf("%i\n", moveSpeed);
       }
 
+      motionProfiler.endLoop();
+
       //*wait to avoid overloading*
       vex::task::sleep(20);
     }
+    motionProfiler.stop();
 
     stopRobot(vex::brakeType::brake);
   }
@@ -258,6 +281,7 @@ namespace evAPI {
     arcPID.setTotalError(0);
     arcDriftPID.setTotalError(0);
     arcPID.resetTimeout();
+    arcDriftPID.resetTimeout();
 
     outerDistance = (((radius + (driveBaseWidth / 2)) * 2) * M_PI) * ((double)angle / 360);  // inches of outer arc
     innerDistance = (((radius - (driveBaseWidth / 2)) * 2) * M_PI) * ((double)angle / 360);  // inches of inner arc
@@ -285,7 +309,10 @@ namespace evAPI {
 
       if(isDebugMode) printf("position, error, moveSpeed\n");
       //*main PID loop*
+      startFaultCheck();
       while(isPIDRunning) {
+        motionProfiler.beginLoop();
+
         //*get encoder positions*
         leftPosition = leftTracker->readTrackerPosition(leftDriveTracker);
         rightPosition = rightTracker->readTrackerPosition(rightDriveTracker);
@@ -302,6 +329,9 @@ namespace evAPI {
         if(moveSpeed > speed) moveSpeed = speed;
         if(moveSpeed < -speed) moveSpeed = -speed;
 
+        //*check for slips, stalls, and collisions
+        if(checkFaults(moveSpeed)) {isPIDRunning = false;}
+
         //*setting motor speeds*
         spinBase((moveSpeed * wheelPowerRatio) + (driftPower / 1000), moveSpeed); // outer wheel always moves at same speed and inner wheel changes to adapt
 
@@ -315,6 +345,8 @@ namespace evAPI {
           printf("%i\n", moveSpeed);
         }
 
+        motionProfiler.endLoop();
+
         //*wait to avoid overloading*
         vex::task::sleep(20);
       }
@@ -329,7 +361,10 @@ namespace evAPI {
 
       if(isDebugMode) printf("position, error, moveSpeed\n");
       //*main PID loop*
+      startFaultCheck();
       while(isPIDRunning) {
+        motionProfiler.beginLoop();
+
         if(slowStart < 1)
         {
           slowStart += 0.005;
@@ -350,6 +385,9 @@ namespace evAPI {
         if(moveSpeed > speed) moveSpeed = speed;
         if(moveSpeed < -speed) moveSpeed = -speed;
 
+        //*check for slips, stalls, and collisions
+        if(checkFaults(moveSpeed)) {isPIDRunning = false;}
+
         //*setting motor speeds*
         spinBase(moveSpeed, (moveSpeed * wheelPowerRatio) + (driftPower / 1000));  // outer wheel always moves at same speed and inner wheel changes to adapt
 
@@ -363,10 +401,13 @@ namespace evAPI {
           printf("%i\n", moveSpeed);
         }
 
+        motionProfiler.endLoop();
+
         //*wait to avoid overloading*
         vex::task::sleep(20);
       }
     }
+    motionProfiler.stop();
     stopRobot(vex::brakeType::brake);
   }
 
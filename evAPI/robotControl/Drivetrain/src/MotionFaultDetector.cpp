@@ -0,0 +1,71 @@
+#include "../include/MotionFaultDetector.h"
+
+namespace evAPI {
+  void MotionFaultDetector::reset() {  // clears the counters at the start of a motion
+    cycleCount = 0;
+    stallCycles = 0;
+    slipCycles = 0;
+    lastFault = motionFault::None;
+  }
+
+  motionFault MotionFaultDetector::update(const faultSample &sample) {  // checks a cycle of samples and returns any fault found
+    cycleCount++;
+    double power = sample.power < 0 ? -sample.power : sample.power;
+
+    //*a collision is a single spike, so it is found on the cycle it happens
+    if(sample.acceleration >= collisionAcceleration) {
+      lastFault = motionFault::Collision;
+      return(motionFault::Collision);
+    }
+
+    //*the motors take a few cycles to get up to speed, so stalls and slips are ignored at the start
+    if(cycleCount <= FAULT_STARTUP_CYCLES) {
+      return(motionFault::None);
+    }
+
+    //*powered motors that draw current without turning are stalled
+    if(power >= stallMinPower && sample.wheelSpeed <= stallMaxSpeed && sample.current >= stallMinCurrent) {
+      stallCycles++;
+    } else {
+      stallCycles = 0;
+    }
+
+    //*wheels that turn faster than the robot moves are slipping. Forward speeds are used so the tracking
+    //*wheels being a different distance from the center than the powered wheels doesn't matter in turns
+    if(sample.hasTracking && sample.wheelForwardSpeed >= slipMinSpeed && sample.trackingSpeed < sample.wheelForwardSpeed * slipRatio) {
+      slipCycles++;
+    } else {
+      slipCycles = 0;
+    }
+
+    if(stallCycles >= FAULT_CONFIRM_CYCLES) {
+      lastFault = motionFault::Stall;
+      return(motionFault::Stall);
+    }
+
+    if(slipCycles >= FAULT_CONFIRM_CYCLES) {
+      lastFault = motionFault::Slip;
+      return(motionFault::Slip);
+    }
+
+    return(motionFault::None);
+  }
+
+  motionFault MotionFaultDetector::getLastFault() {  // returns the last fault found since the last reset
+    return(lastFault);
+  }
+
+  void MotionFaultDetector::setStallLimits(double minPower, double maxSpeed, double minCurrent) {  // sets the values that count as a stall
+    stallMinPower = minPower;
+    stallMaxSpeed = maxSpeed;
+    stallMinCurrent = minCurrent;
+  }
+
+  void MotionFaultDetector::setSlipRatio(double ratio) {  // sets how much slower than the wheels the tracking encoders have to be for a slip
+    slipRatio = ratio;
+  }
+
+  void MotionFaultDetector::setCollisionAcceleration(double acceleration) {  // sets the acceleration in g that counts as a collision
+    collisionAcceleration = acceleration;
+  }
+}  // namespace evAPI
@@ -0,0 +1,105 @@
+#include "../include/MotorHealthMonitor.h"
+
+namespace evAPI {
+  int motorHealthThread(void *monitorObject) {  // function run by the thread
+    MotorHealthMonitor *monitor = (MotorHealthMonitor*)monitorObject;
+    while(1) {
+      taskManager.beginWork(monitor->healthTaskID);
+      monitor->update();
+      taskManager.endWork(monitor->healthTaskID);
+      vex::this_thread::sleep_for(MOTOR_HEALTH_SAMPLE_TIME);
+    }
+    return(0);
+  }
+
+  void MotorHealthMonitor::addMotor(vex::motor * motor) {  // adds a motor to watch
+    for(int i = 0; i < motorCount; i++) {
+      if(motors[i] == motor) return;  // already being watched
+    }
+    if(motor != nullptr && motorCount < MOTOR_HEALTH_MAX_MOTORS) {
+      motors[motorCount] = motor;
+      motorCount++;
+    }
+  }
+
+  void MotorHealthMonitor::update() {  // samples every motor and updates the current limit
+    if(motorCount == 0) return;
+
+    //*read every motor
+    double hottest = 0;
+    double totalCurrent = 0;
+    for(int i = 0; i < motorCount; i++) {
+      double temperature = motors[i]->temperature(vex::temperatureUnits::celsius);
+      if(temperature > hottest) hottest = temperature;
+      totalCurrent += motors[i]->current(vex::currentUnits::amp);
+    }
+    maxTemperature = hottest;
+    averageCurrent = totalCurrent / motorCount;
+
+    //*filter the heating rate, since the motors only report the temperature in large steps
+    uint32_t sampleTime = vex::timer::system();
+    if(lastTemperature >= 0 && sampleTime != lastSampleTime) {
+      double rate = (hottest - lastTemperature) / ((sampleTime - lastSampleTime) / 1000.0);
+      heatingRate += 0.2 * (rate - heatingRate);
+    }
+    lastTemperature = hottest;
+    lastSampleTime = sampleTime;
+
+    //*lower the current as the motors get close to the throttle temperature so the firmware never has to
+    double targetLimit = MOTOR_MAX_CURRENT;
+    if(limiting && hottest > MOTOR_LIMIT_START_TEMPERATURE) {
+      double heat = (hottest - MOTOR_LIMIT_START_TEMPERATURE) / (MOTOR_THROTTLE_TEMPERATURE - MOTOR_LIMIT_START_TEMPERATURE);
+      if(heat > 1) heat = 1;
+      targetLimit = MOTOR_MAX_CURRENT - heat * (MOTOR_MAX_CURRENT - MOTOR_LIMIT_MIN_CURRENT);
+    }
+
+    //*change the limit slowly so the driver doesn't feel a jump
+    double newLimit = targetLimit;
+    if(newLimit > currentLimit + MOTOR_LIMIT_MAX_STEP) newLimit = currentLimit + MOTOR_LIMIT_MAX_STEP;
+    if(newLimit < currentLimit - MOTOR_LIMIT_MAX_STEP) newLimit = currentLimit - MOTOR_LIMIT_MAX_STEP;
+
+    if(newLimit != currentLimit) {
+      currentLimit = newLimit;
+      for(int i = 0; i < motorCount; i++) {
+        motors[i]->setMaxTorque(currentLimit, vex::currentUnits::amp);
+      }
+    }
+  }
+
+  void MotorHealthMonitor::start() {  // starts a thread that calls update at the sample rate
+    if(healthThread != nullptr) return;
+    healthThread = new vex::thread(motorHealthThread, this);
+    healthTaskID = taskManager.addTask(healthThread, taskRole::Sensor, "Motor Health");
+  }
+
+  void MotorHealthMonitor::setLimiting(bool enabled) {  // turns the current limiting on or off
+    limiting = enabled;
+  }
+
+  double MotorHealthMonitor::getMaxTemperature() {  // returns the temperature of the hottest motor in celsius
+    return(maxTemperature);
+  }
+
+  double MotorHealthMonitor::getAverageCurrent() {  // returns the average current of the motors in amps
+    return(averageCurrent);
+  }
+
+  double MotorHealthMonitor::getHeatingRate() {  // returns how fast the hottest motor is heating in celsius per second
+    return(heatingRate);
+  }
+
+  double MotorHealthMonitor::getTimeToThrottle() {  // returns the predicted seconds until throttling, -1 if it isn't heating
+    if(maxTemperature >= MOTOR_THROTTLE_TEMPERATURE) return(0);
+    if(heatingRate <= 0.001) return(-1);
+    return((MOTOR_THROTTLE_TEMPERATURE - maxTemperature) / heatingRate);
+  }
+
+  double MotorHealthMonitor::getCurrentLimit() {  // returns the current limit set on the motors in amps
+    return(currentLimit);
+  }
+
+  bool MotorHealthMonitor::hasWarning() {  // returns true if the motors are limited or will throttle soon
+    double timeToThrottle = getTimeToThrottle();
+    return(currentLimit < MOTOR_MAX_CURRENT || (timeToThrottle >= 0 && timeToThrottle < MOTOR_HEALTH_WARNING_TIME));
+  }
+}  // namespace evAPI
@@ -6,31 +6,58 @@ namespace evAPI {
   void hiddenOdoThreadFunction();  // function for odo thread
 
   void Drive::odoThreadFunction() {  // command only called by odo thread loop
-    int positionChange = (leftTracker->readTrackerPosition(leftOdoTracker) + rightTracker->readTrackerPosition(rightOdoTracker)) / 2;
-    int headingChange = turnSensor->rotation(vex::rotationUnits::deg);
-    int robotHeading = turnSensor->heading(vex::rotationUnits::deg);
-    leftAndRight arcDirection;
-    if(leftTracker->readTrackerPosition(leftOdoTracker) > rightTracker->readTrackerPosition(rightOdoTracker)) {
-      arcDirection = RIGHT;
-    }
-    if(leftTracker->readTrackerPosition(leftOdoTracker) < rightTracker->readTrackerPosition(rightOdoTracker)) {
-      arcDirection = LEFT;
+    taskManager.beginWork(odoTaskID);
+    odoProfiler.beginLoop();
+
+    //*only run the math when the encoders have sent a new sample
+    uint32_t sampleTime = leftTracker->readSampleTime();
+    if(sampleTime != lastOdoSampleTime) {
+      //*read each sensor once and reset it right away so no movement is lost between samples
+      double leftChange = leftTracker->readTrackerPosition(leftOdoTracker);
+      double rightChange = rightTracker->readTrackerPosition(rightOdoTracker);
+      leftTracker->resetTrackerPosition(leftOdoTracker);
+      rightTracker->resetTrackerPosition(rightOdoTracker);
+      double headingChange = turnSensor->rotation(vex::rotationUnits::deg);
+      double robotHeading = turnSensor->heading(vex::rotationUnits::deg);
+      turnSensor->resetRotation();
+
+      //*convert the encoder degrees to inches so the position is in inches
+      double leftDistance = leftChange / (leftEncoder ? leftEncoderDegsPerInch : degsPerInch);
+      double rightDistance = rightChange / (rightEncoder ? rightEncoderDegsPerInch : degsPerInch);
+
+      odoTracker.runMath((leftDistance + rightDistance) / 2, robotHeading, headingChange, sampleTime);
+      lastOdoSampleTime = sampleTime;
+
+      //*update the velocities with the same samples
+      leftOdoDistance += leftDistance;
+      rightOdoDistance += rightDistance;
+      odoRotation += headingChange;
+      leftVelocity.update(leftOdoDistance, sampleTime);
+      rightVelocity.update(rightOdoDistance, sampleTime);
+      turnVelocity.update(odoRotation, sampleTime);
     }
-    odoTracker.runMath(positionChange, robotHeading, headingChange, arcDirection);
 
-    turnSensor->resetRotation();
-    leftTracker->resetTrackerPosition(leftOdoTracker);
-    rightTracker->resetTrackerPosition(rightOdoTracker);
+    odoProfiler.endLoop();
+    taskManager.endWork(odoTaskID);
   }
 
   void Drive::startOdoThread() {  // starts the odo tracking thread
     odoThread = new vex::thread(hiddenOdoThreadFunction);
+    odoTaskID = taskManager.addTask(odoThread, taskRole::Odometry, "Odometry");
+  }
+
+  double Drive::getXPosition() {  // x position from the odo tracker
+    return odoTracker.getXPosition();
+  }
+
+  double Drive::getYPosition() {  // y position from the odo tracker
+    return odoTracker.getYPosition();
   }
 
   void hiddenOdoThreadFunction() {  // function for odo thread
     while(1) {
       threadReference->odoThreadFunction();
-      vex::this_thread::sleep_for(20);
+      vex::this_thread::sleep_for(threadReference->getOdoRate());
     }
   }
 }  // namespace evAPI
@@ -9,23 +9,200 @@ namespace evAPI
 
   double Drive::getMotorSpeed(vex::turnType side)
   {
-    double wheelVelocity;
+    vex::motor *sideMotors[4];
 
     if(side == vex::turnType::left)
     {
-      wheelVelocity = leftMotor1->velocity(vex::pct);
+      sideMotors[0] = leftMotor1;
+      sideMotors[1] = leftMotor2;
+      sideMotors[2] = leftMotor3;
+      sideMotors[3] = leftMotor4;
     }
 
     else
     {
-      wheelVelocity = rightMotor1->velocity(vex::pct);
+      sideMotors[0] = rightMotor1;
+      sideMotors[1] = rightMotor2;
+      sideMotors[2] = rightMotor3;
+      sideMotors[3] = rightMotor4;
     }
 
-    //TODO: Fix this crap
-    //Convert the motor velocity to the wheel velocity
-    //wheelVelocity *= (gearInput / gearOutput)/*  * (2 * M_PI * wheelSize) */;
+    //*Average the motors on the side in degrees per second
+    double motorVelocity = 0;
+    int motorCount = 0;
 
-    return wheelVelocity;
+    for(int i = 0; i < 4; i++)
+    {
+      if(sideMotors[i] != nullptr)
+      {
+        motorVelocity += sideMotors[i]->velocity(vex::velocityUnits::dps);
+        motorCount++;
+      }
+    }
+
+    if(motorCount == 0 || degsPerInch == 0)
+    {
+      return 0;
+    }
+
+    //Convert the motor velocity to the wheel velocity. degsPerInch includes the gear ratio.
+    return (motorVelocity / motorCount) / degsPerInch;
+  }
+
+  double Drive::getVelocity()
+  {
+    return (leftVelocity.getVelocity() + rightVelocity.getVelocity()) / 2;
+  }
+
+  double Drive::getSideVelocity(vex::turnType side)
+  {
+    if(side == vex::turnType::left)
+    {
+      return leftVelocity.getVelocity();
+    }
+
+    return rightVelocity.getVelocity();
+  }
+
+  double Drive::getTurnVelocity()
+  {
+    return turnVelocity.getVelocity();
+  }
+
+  double Drive::getHeading()
+  {
+    if(turnSensor == nullptr)
+    {
+      return 0;
+    }
+
+    return turnSensor->heading(vex::rotationUnits::deg);
+  }
+
+  bool Drive::hasHeadingSensor()
+  {
+    return turnSensor != nullptr && turnSensor->installed();
+  }
+
+  //*Motor health
+
+  void Drive::startHealthMonitor()
+  {
+    vex::motor *baseMotors[8] = {leftMotor1, leftMotor2, leftMotor3, leftMotor4,
+                                 rightMotor1, rightMotor2, rightMotor3, rightMotor4};
+
+    for(int i = 0; i < 8; i++)
+    {
+      baseHealth.addMotor(baseMotors[i]);
+    }
+
+    baseHealth.start();
+  }
+
+  MotorHealthMonitor& Drive::getHealthMonitor()
+  {
+    return baseHealth;
+  }
+
+  //*Fault detection
+
+  void Drive::setFaultResponse(motionFault fault, faultResponse response)
+  {
+    faultResponses[(int)fault] = response;
+  }
+
+  motionFault Drive::getLastFault()
+  {
+    return faultDetector.getLastFault();
+  }
+
+  MotionFaultDetector& Drive::getFaultDetector()
+  {
+    return faultDetector;
+  }
+
+  void Drive::startFaultCheck()
+  {
+    faultDetector.reset();
+    faultPowerScale = 1;
+  }
+
+  bool Drive::checkFaults(int &moveSpeed)
+  {
+    faultSample sample;
+    sample.power = moveSpeed;
+
+    //*Speed of the powered wheels. Turns spin the sides in opposite directions, so the sizes are used for
+    //*stalls. Slips use the forward speed of the center, which the tracking wheels measure too.
+    double leftSpeed = getMotorSpeed(vex::turnType::left);
+    double rightSpeed = getMotorSpeed(vex::turnType::right);
+    sample.wheelSpeed = (fabs(leftSpeed) + fabs(rightSpeed)) / 2;
+    sample.wheelForwardSpeed = fabs(leftSpeed + rightSpeed) / 2;
+
+    //*Forward speed of the tracking wheels. It is 0 in a point turn, the same as the powered wheels.
+    sample.hasTracking = leftEncoder != nullptr && rightEncoder != nullptr;
+    sample.trackingSpeed = 0;
+
+    if(sample.hasTracking)
+    {
+      sample.trackingSpeed = fabs(leftEncoder->velocity(vex::velocityUnits::dps) / leftEncoderDegsPerInch +
+                                  rightEncoder->velocity(vex::velocityUnits::dps) / rightEncoderDegsPerInch) / 2;
+    }
+
+    sample.current = getAverageCurrent();
+
+    //*Only the flat acceleration is used so gravity isn't counted
+    sample.acceleration = 0;
+
+    if(turnSensor != nullptr)
+    {
+      sample.acceleration = hypot(turnSensor->acceleration(vex::axisType::xaxis),
+                                  turnSensor->acceleration(vex::axisType::yaxis));
+    }
+
+    //*Respond to any fault
+    motionFault fault = faultDetector.update(sample);
+
+    if(fault != motionFault::None)
+    {
+      if(isDebugMode) printf("motion fault: %i\n", (int)fault);
+
+      switch(faultResponses[(int)fault])
+      {
+        case faultResponse::Abort:
+          moveSpeed = 0;
+          return true;
+
+        case faultResponse::ReducePower:
+          faultPowerScale = FAULT_REDUCED_POWER;
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    moveSpeed *= faultPowerScale;
+    return false;
+  }
+
+  double Drive::getAverageCurrent()
+  {
+    vex::motor *baseMotors[8] = {leftMotor1, leftMotor2, leftMotor3, leftMotor4,
+                                 rightMotor1, rightMotor2, rightMotor3, rightMotor4};
+    double current = 0;
+    int motorCount = 0;
+
+    for(int i = 0; i < 8; i++)
+    {
+      if(baseMotors[i] != nullptr)
+      {
+        current += baseMotors[i]->current(vex::currentUnits::amp);
+        motorCount++;
+      }
+    }
+
+    return motorCount == 0 ? 0 : current / motorCount;
   }
 
 } // namespace evAPI
\ No newline at end of file
@@ -33,6 +33,14 @@ double SmartEncoder::readTrackerPosition(int trackerID) {  //reads a tracker of
   return(encoderRead() - encoderOffsets[trackerID]);
 }
 
+uint32_t SmartEncoder::readSampleTime() {  //reads the time the encoder sent its last sample
+  if(rotationEncoder != nullptr) {
+    return(rotationEncoder->timestamp());
+  } else {
+    return(motorEncoder->timestamp());
+  }
+}
+
 double SmartEncoder::encoderRead() {  //reads the raw encoder, motor or rotation
   if(rotationEncoder != nullptr) {
     return(rotationEncoder->position(vex::rotationUnits::deg));
@@ -0,0 +1,172 @@
+#include "../../../robotControl/Drivetrain/include/Drive.h"
+#include "../../../VisionTracker/include/VisionFilters.h"
+
+namespace evAPI {
+  static double wrapAngle(double angle) {  // wraps an angle to -180 to 180 degrees
+    angle = fmod(angle, 360);
+    if(angle > 180) angle -= 360;
+    if(angle < -180) angle += 360;
+    return angle;
+  }
+
+  bool Drive::driveToObject(VisionTracker &tracker, double stopDistance, int speed) {  // drives up to an object seen by the vision sensor
+    //*setup of all variables*
+    double heading;  // heading of the robot in degrees
+    double xPosition;  // x position of the robot in inches
+    double yPosition;  // y position of the robot in inches
+    double angle;  // degrees from the front of the robot to the object
+    double distance;  // filtered distance to the object in inches
+    double targetX = 0;  // x position the object was last seen at
+    double targetY = 0;  // y position the object was last seen at
+    bool hasTarget = false;  // is true once the object has been seen
+    uint16_t lockedID = 0;  // ID of the object being driven to
+    uint32_t lastFrameNumber = tracker.getFrame().frameNumber;  // number of the last frame used
+    int missedFrames = 0;  // frames in a row without the object
+    double turnError = 0;  // degrees the robot needs to turn to face the object
+    double driveError = 0;  // inches left to drive
+    bool isPIDRunning = true;  // is true as the PID is running
+    bool hasFaulted = false;  // is true if a fault stopped the robot
+    int moveSpeed;  // the forward speed the motors are set to every cycle
+    int turnPower;  // output of the turn PID
+    Kalman1D distanceFilter(1, 4);  // smooths the distance over frames
+    visionTurnPID.setTotalError(0);
+    visionDrivePID.setTotalError(0);
+    visionTurnPID.resetTimeout();
+    visionDrivePID.resetTimeout();
+
+    //*print debug header*
+    if(isDebugMode) printf("seen, turnError, driveError, moveSpeed, turnPower\n");
+
+    //*main PID loop*
+    startFaultCheck();
+    while(isPIDRunning) {
+      //*wait for a new frame, so each frame is only used once*
+      tracker.trackObject();  // only takes a snapshot if the vision thread isn't running
+      VisionFrame frame = tracker.getFrame();
+      uint32_t waitStart = vex::timer::system();
+      while(frame.frameNumber == lastFrameNumber) {
+        if(vex::timer::system() - waitStart > VISION_SEARCH_FRAMES * VISION_FRAME_TIME) {
+          if(isDebugMode) printf("no frames from the vision sensor\n");
+          motionProfiler.stop();
+          stopRobot(vex::brakeType::brake);
+          return false;
+        }
+        vex::task::sleep(VISION_POLL_TIME);
+        frame = tracker.getFrame();
+      }
+      lastFrameNumber = frame.frameNumber;
+
+      motionProfiler.beginLoop();
+
+      //*get the robot position*
+      heading = getHeading();
+      xPosition = getXPosition();
+      yPosition = getYPosition();
+
+      //*keep driving to the same object while it is tracked*
+      int index = lockedID != 0 ? frame.find(lockedID) : -1;
+      if(index == -1) {
+        index = frame.selected;
+
+        //after the object is lost, only switch to an object where the lost one was
+        if(index != -1 && hasTarget) {
+          double newDistance = tracker.estimateDistance(frame.width[index]);
+          double newHeading = (heading + tracker.estimateAngle(frame.centerX[index])) * M_PI / 180;
+          double newX = xPosition + newDistance * sin(newHeading);
+          double newY = yPosition + newDistance * cos(newHeading);
+          if(hypot(newX - targetX, newY - targetY) > VISION_REACQUIRE_DISTANCE) index = -1;
+        }
+
+        if(index != -1) lockedID = frame.objectID[index];
+      }
+
+      //*calculate error for this cycle*
+      if(index != -1) {
+        //steer with the camera while the object can be seen
+        angle = tracker.estimateAngle(frame.centerX[index]);
+        distance = distanceFilter.update(tracker.estimateDistance(frame.width[index]));
+        targetX = xPosition + distance * sin((heading + angle) * M_PI / 180);
+        targetY = yPosition + distance * cos((heading + angle) * M_PI / 180);
+        hasTarget = true;
+        missedFrames = 0;
+
+        turnError = angle;
+        driveError = distance - stopDistance;
+      } else if(hasTarget) {
+        missedFrames++;
+
+        //keep the last errors from the camera if the object was only missed for a few frames, then drive
+        //to where the object was last seen with odometry
+        if(missedFrames >= VISION_LOST_FRAMES) {
+          double xChange = targetX - xPosition;
+          double yChange = targetY - yPosition;
+          turnError = wrapAngle(atan2(xChange, yChange) * 180 / M_PI - heading);
+          driveError = hypot(xChange, yChange) - stopDistance;
+        }
+      } else {
+        //the object hasn't been seen yet
+        missedFrames++;
+        if(missedFrames >= VISION_SEARCH_FRAMES) {
+          if(isDebugMode) printf("no object found\n");
+          motionProfiler.stop();
+          stopRobot(vex::brakeType::brake);
+          return false;
+        }
+
+        motionProfiler.endLoop();
+        int32_t sleepTime = (int32_t)(frame.captureTime + VISION_FRAME_TIME - vex::timer::system());
+        if(sleepTime > 0) vex::task::sleep(sleepTime);
+        continue;
+      }
+
+      //*adding all tunning values*
+      turnPower = visionTurnPID.compute(turnError);
+      moveSpeed = visionDrivePID.compute(driveError);
+
+      //*speed cap
+      if(moveSpeed > speed) moveSpeed = speed;
+      if(moveSpeed < -speed) moveSpeed = -speed;
+      if(turnPower > speed) turnPower = speed;
+      if(turnPower < -speed) turnPower = -speed;
+
+      //*only drive forward as much as the robot is facing the object
+      if(fabs(turnError) > 90) {
+        moveSpeed = 0;
+      } else {
+        moveSpeed *= cos(turnError * M_PI / 180);
+      }
+
+      //*check for slips, stalls, and collisions
+      if(checkFaults(moveSpeed)) {isPIDRunning = false; hasFaulted = true;}
+
+      //*setting motor speeds*
+      spinBase(moveSpeed + turnPower, moveSpeed - turnPower);
+
+      //*stopping code*
+      if(visionDrivePID.isSettled()) {isPIDRunning = false;}
+
+      //*print debug data*
+      if(isDebugMode) {
+        printf("%i, ", index != -1);
+        printf("%f, ", turnError);
+        printf("%f, ", driveError);
+        printf("%i, ", moveSpeed);
+        printf("%i\n", turnPower);
+      }
+
+      motionProfiler.endLoop();
+
+      //*wait until the next frame from the vision sensor should be ready*
+      int32_t sleepTime = (int32_t)(frame.captureTime + VISION_FRAME_TIME - vex::timer::system());
+      if(sleepTime > 0) vex::task::sleep(sleepTime);
+    }
+    motionProfiler.stop();
+    stopRobot(vex::brakeType::brake);
+
+    return !hasFaulted && fabs(driveError) < visionDrivePID.getSettleError();
+  }
+
+  bool Drive::driveToObject(VisionTracker &tracker, double stopDistance) {  // drives up to an object at the drive speed
+    return driveToObject(tracker, stopDistance, driveSpeed);
+  }
+}  // namespace evAPI
@@ -173,16 +173,30 @@ namespace evAPI {
   /*----- encoder setup -----*/
   void Drive::leftEncoderSetup(int port, double wheelSize, bool reverse) {    //setup values for left encoder
     leftEncoder = new vex::rotation(smartPortLookupTable[port], reverse);
+    leftEncoder->datarate(odoRate);
     leftEncoderDegsPerInch = (360 / (wheelSize * M_PI));
     leftTracker->setEncoderRotation(leftEncoder);
   }
 
   void Drive::rightEncoderSetup(int port, double wheelSize, bool reverse) {    //setup values for right encoder
     rightEncoder = new vex::rotation(smartPortLookupTable[port], reverse);
+    rightEncoder->datarate(odoRate);
     rightEncoderDegsPerInch = (360 / (wheelSize * M_PI));
     rightTracker->setEncoderRotation(rightEncoder);
   }
 
+  void Drive::setOdoRate(uint rate) {  //sets the odo rate and matches the encoder data rate to it
+    if(rate < ODO_MIN_RATE) rate = ODO_MIN_RATE;
+    odoRate = rate;
+    if(leftEncoder) leftEncoder->datarate(rate);
+    if(rightEncoder) rightEncoder->datarate(rate);
+    odoProfiler.setTargetPeriod(rate);
+  }
+
+  uint Drive::getOdoRate() {  //gets the time between odo updates
+    return odoRate;
+  }
+
   /*----- pid setup -----*/
   void Drive::setupDrivePID(double kp, double ki, double kd, int minStopError, int timeToStop, int timeoutTime) {
     drivePID.setConstants(kp, ki, kd);
@@ -234,6 +248,74 @@ namespace evAPI {
     arcDriftTimeToStop = timeToStop;
   }
 
+  void Drive::setupVisionTurnPID(double kp, double ki, double kd, int minStopError, int timeToStop, int timeoutTime) {
+    visionTurnPID.setConstants(kp, ki, kd);
+    visionTurnPID.setStoppings(minStopError, timeToStop, timeoutTime);
+  }
+
+  void Drive::setupVisionDrivePID(double kp, double ki, double kd, int minStopError, int timeToStop, int timeoutTime) {
+    visionDrivePID.setConstants(kp, ki, kd);
+    visionDrivePID.setStoppings(minStopError, timeToStop, timeoutTime);
+  }
+
+  PID& Drive::getPID(pidType type) {  //gets a PID for live tuning
+    switch(type) {
+      case pidType::Turn:
+        return turnPID;
+      case pidType::Drift:
+        return driftPID;
+      case pidType::Arc:
+        return arcPID;
+      case pidType::ArcDrift:
+        return arcDriftPID;
+      case pidType::VisionTurn:
+        return visionTurnPID;
+      case pidType::VisionDrive:
+        return visionDrivePID;
+      default:
+      case pidType::Drive:
+        return drivePID;
+    }
+  }
+
+  LoopProfiler& Drive::getOdoProfiler() {  //gets the timing of the odo thread
+    return odoProfiler;
+  }
+
+  LoopProfiler& Drive::getMotionProfiler() {  //gets the timing of the drive function loops
+    return motionProfiler;
+  }
+
+  /*----- config setup -----*/
+  void driveConfigReload(void *driveObject) {  //called by the config store after it reloads
+    Drive *drive = (Drive*)driveObject;
+    drive->applyConfig(*drive->config);
+  }
+
+  evError Drive::useConfig(ConfigStore &config) {  //loads values now and every time the file is reloaded
+    this->config = &config;
+    applyConfig(config);
+    return config.addReloadCallback(driveConfigReload, this);
+  }
+
+  void Drive::applyConfig(ConfigStore &config) {  //reads all the values from the config store
+    geartrainSetup(config.getNumber("drive.wheelDiameter", wheelSize),
+                   config.getInt("drive.gearIn", gearInput),
+                   config.getInt("drive.gearOut", gearOutput));
+    setDriveBaseWidth(config.getNumber("drive.baseWidth", driveBaseWidth));
+    setDriveSpeed(config.getInt("drive.driveSpeed", driveSpeed));
+    setTurnSpeed(config.getInt("drive.turnSpeed", turnSpeed));
+    setArcTurnSpeed(config.getInt("drive.arcTurnSpeed", arcTurnSpeed));
+
+    drivePID.loadConfig(config, "drivePID");
+    turnPID.loadConfig(config, "turnPID");
+    driftPID.loadConfig(config, "driftPID");
+    arcPID.loadConfig(config, "arcPID");
+    arcDriftPID.loadConfig(config, "arcDriftPID");
+    visionTurnPID.loadConfig(config, "visionTurnPID");
+    visionDrivePID.loadConfig(config, "visionDrivePID");
+  }
+
   /*----- inertial setup -----*/
   void Drive::setupInertialSensor(int port) {  //sets the port of the inertial sensor
     turnSensor = new vex::inertial(smartPortLookupTable[port]);
@@ -2,6 +2,7 @@
 #define __ODOMATH_H__
 
 #include <math.h>
+#include <stdint.h>
 #include "../evAPI/Common/include/evNamespace.h"
 
 namespace evAPI
@@ -9,16 +10,17 @@ namespace evAPI
 
   class OdoMath {
     public:
-      void setPosition(int xPos, int yPos);  // sets the current robot position
-      void resetHeading();  // resets the stored heading to 0
-      void runMath(int travelDistance, int robotHeading, int headingChange, leftAndRight arcDirection);  // runs the odo math and updates the counters
-      int getXPosition();  // returns the robot x position
-      int getYPosition();  // returns the robot y position
+      void setPosition(double xPos, double yPos);  // sets the current robot position
+      void runMath(double travelDistance, double robotHeading, double headingChange, uint32_t sampleTime);  // runs the odo math and updates the counters
+      double getXPosition();  // returns the robot x position
+      double getYPosition();  // returns the robot y position
+      double getSpeed();  // returns the speed of the robot in distance units per second
   
     private:
-      int xPosition;  // coordinate of the robot x
-      int yPosition;  // coordinate of the robot y
-      int previousHeading;  // heading last time the math was run
+      double xPosition = 0;  // coordinate of the robot x
+      double yPosition = 0;  // coordinate of the robot y
+      double speed = 0;  // speed between the last two samples
+      uint32_t lastSampleTime = 0;  // time of the last sample in msec, 0 if there wasn't one
   
   };
 
@@ -0,0 +1,33 @@
+#ifndef __VELOCITYESTIMATOR_H__
+#define __VELOCITYESTIMATOR_H__
+
+#include <stdint.h>
+
+namespace evAPI
+{
+
+  // Alpha-beta filter that estimates a velocity from position samples. Each sample predicts the
+  // position from the last velocity, then moves the position and velocity toward the measurement.
+  // This is a fixed gain Kalman filter, so it smooths the noise of a plain finite difference
+  // without the lag of averaging many samples.
+  class VelocityEstimator {
+    public:
+      void setGains(double alphaIN, double betaIN);  // sets how much each sample corrects the position and velocity
+      void reset(double startPosition);  // clears the velocity and starts at a position
+      void update(double measuredPosition, uint32_t sampleTime);  // adds a position sample taken at a time in msec
+      double getPosition();  // returns the filtered position
+      double getVelocity();  // returns the filtered velocity in position units per second
+
+    private:
+      double alpha = 0.5;  // amount of the position error added to the position each sample
+      double beta = 0.17;  // amount of the position error rate added to the velocity each sample
+      double position = 0;  // filtered position
+      double velocity = 0;  // filtered velocity
+      uint32_t lastSampleTime = 0;  // time of the last sample in msec
+      bool hasSample = false;  // true once the first sample has been added
+
+  };
+
+} // namespace evAPI
+
+#endif // __VELOCITYESTIMATOR_H__
@@ -3,49 +3,46 @@
 namespace evAPI
 {
 
-  void OdoMath::setPosition(int xPos, int yPos) {  // sets the current robot position
+  void OdoMath::setPosition(double xPos, double yPos) {  // sets the current robot position
     xPosition = xPos;
     yPosition = yPos;
   }
 
-  void OdoMath::resetHeading() {  // resets the stored heading to 0
-    previousHeading = 0;
+  void OdoMath::runMath(double travelDistance, double robotHeading, double headingChange, uint32_t sampleTime) {  // runs the odo math and updates the counters
+    // Headings are clockwise from the y axis, so a heading of 0 drives along +y and 90 drives along +x
+    double tArc = headingChange * (M_PI / 180);  // Overall angle of the arc, positive for a right turn
+    double tStart = (robotHeading - headingChange) * (M_PI / 180);  // Heading of the robot before the turn
+    double tSec = tStart + (.5 * tArc);  // The secant line points halfway between the start and end heading
+
+    // Length of the secant line. A straight line has no turn radius, so it uses the arc length directly.
+    double lSec;
+    if(fabs(tArc) < 1e-6) {
+      lSec = travelDistance;
+    } else {
+      double r = travelDistance / tArc;  // Radius of the turn arc
+      lSec = 2 * r * sin(tArc / 2);
+    }
+
+    xPosition += lSec * sin(tSec);
+    yPosition += lSec * cos(tSec);
+
+    // Use the real time between the samples for the speed
+    if(lastSampleTime != 0 && sampleTime != lastSampleTime) {
+      speed = travelDistance / ((sampleTime - lastSampleTime) / 1000.0);
+    }
+    lastSampleTime = sampleTime;
   }
 
-  void OdoMath::runMath(int travelDistance, int robotHeading, int headingChange, leftAndRight arcDirection) {  // runs the odo math and updates the counters
-    int dirMod;  // direction modifier for left and right arcs
-    if(arcDirection == LEFT) dirMod = 1;
-    if(arcDirection == RIGHT) dirMod = -1;
-
-    int dStart = previousHeading;  // Heading of the robot before the turn
-    int dTurn = headingChange;  // The angle of the turn arc
-    int dWorking = dTurn * dirMod;  // Sets the start heading to be the correct sign for right or left turn 
-    int lArc = travelDistance;  // Length of the arc
-
-    double tStart = (dStart - 90) * (M_PI / 180);  // Starting angle along arc circle
-    double tArc = dWorking * (M_PI / 180);  // Overall angle of the arc
-    double tSec = .5 * tArc;  // Angle of the secant line relative to the tangent lin on the turning arc of the circle
-    double tTurn = (M_PI / 2) - (tSec + tStart);  // Angle of the secant line relative to the x-axis
-
-    double r = lArc / tArc;  // Radius of the turn arc
-    double rWorking = dirMod * r;  // Sets the radius to be the correct sign for the right or left turn
-
-    double lSec = 2 * rWorking * sin(tArc / 2);  // Length of the secant line
-    double lXDis = lSec * cos(tTurn);  // Length of the x vector
-    double lYDis = lSec * sin(tTurn);  // Length of the y vector
-
-    previousHeading = robotHeading;
-    xPosition += lXDis;
-    yPosition += lYDis;
-
-  }
-
-  int OdoMath::getXPosition() {  // returns the robot x position
+  double OdoMath::getXPosition() {  // returns the robot x position
     return(xPosition);
   }
 
-  int OdoMath::getYPosition() {  // returns the robot y position
+  double OdoMath::getYPosition() {  // returns the robot y position
     return(yPosition);
   }
 
+  double OdoMath::getSpeed() {  // returns the speed of the robot in distance units per second
+    return(speed);
+  }
+
 } // namespace evAPI
\ No newline at end of file
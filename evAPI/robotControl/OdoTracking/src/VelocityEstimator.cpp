@@ -0,0 +1,46 @@
+#include "../include/VelocityEstimator.h"
+
+namespace evAPI
+{
+
+  void VelocityEstimator::setGains(double alphaIN, double betaIN) {  // sets how much each sample corrects the position and velocity
+    alpha = alphaIN;
+    beta = betaIN;
+  }
+
+  void VelocityEstimator::reset(double startPosition) {  // clears the velocity and starts at a position
+    position = startPosition;
+    velocity = 0;
+    hasSample = false;
+  }
+
+  void VelocityEstimator::update(double measuredPosition, uint32_t sampleTime) {  // adds a position sample taken at a time in msec
+    // The first sample only sets the starting point
+    if(!hasSample) {
+      position = measuredPosition;
+      lastSampleTime = sampleTime;
+      hasSample = true;
+      return;
+    }
+
+    // Samples with the same time don't have new data
+    if(sampleTime == lastSampleTime) return;
+    double dt = (sampleTime - lastSampleTime) / 1000.0;
+    lastSampleTime = sampleTime;
+
+    // Predict where the robot is from the last velocity, then correct with the error
+    position += velocity * dt;
+    double error = measuredPosition - position;
+    position += alpha * error;
+    velocity += (beta / dt) * error;
+  }
+
+  double VelocityEstimator::getPosition() {  // returns the filtered position
+    return(position);
+  }
+
+  double VelocityEstimator::getVelocity() {  // returns the filtered velocity in position units per second
+    return(velocity);
+  }
+
+} // namespace evAPI
@@ -4,7 +4,11 @@
 #include "../../../Common/include/evAPIBasicConfig.h"
 #include "../../../Common/include/evNamespace.h"
 #include "../../../Common/include/colors.h"
+#include "../../../Common/include/generalFunctions.h"
+#include "../../../Common/include/TaskManager.h"
+#include "../../../Common/include/LoopProfiler.h"
 #include "Button.h"
+#include "ScreenBuffer.h"
 #include "pageArrowsIcons.h"
 #include "iconArrays.h"
 #include "AutoData.h"
@@ -12,6 +16,15 @@
 
 #define MAX_BUTTON_COUNT 64
 
+// Size of the grid used to find which button was pressed
+#define HIT_GRID_CELL_SIZE 32
+#define HIT_GRID_COLUMNS ((BRAIN_SCREEN_WIDTH + HIT_GRID_CELL_SIZE - 1) / HIT_GRID_CELL_SIZE)
+#define HIT_GRID_ROWS ((BRAIN_SCREEN_HEIGHT + HIT_GRID_CELL_SIZE - 1) / HIT_GRID_CELL_SIZE)
+// Every button can be on one page with any layout, so each cell has room for all of them. Lookups stop at
+// the first empty spot, so a press still only checks the few buttons in its cell. The 15 x 9 grid takes 8640
+// bytes.
+#define HIT_GRID_CELL_CAPACITY MAX_BUTTON_COUNT
+
 namespace evAPI {
   class AutoSelector {
     public:
@@ -69,6 +82,18 @@ namespace evAPI {
       */
       int addButton(int ID, vex::color buttonColor);
   
+      /**
+       * @brief Moves a button to any page and place on the screen. Buttons are placed in a 2 by 4 grid
+       *        with 8 buttons per page by default.
+       * @param ID The ID of the target button.
+       * @param page The page the button is on.
+       * @param x The x position of the top left corner of the button.
+       * @param y The y position of the top left corner of the button.
+       * @param width The width of the button.
+       * @param height The height of the button.
+      */
+      void setButtonLayout(int ID, int page, int x, int y, int width, int height);
+
       /**
        * @brief Adds a function to run when a given button is pressed.
        * @param ID The ID of the target button.
@@ -101,9 +126,11 @@ namespace evAPI {
       /**
        * @brief Sets the icon of a button.
        * @param ID The ID of the target button.
-       * @param icon The icon. A 35x35 boolean array.
+       * @param icon The icon. Use one from icons, or make one with packIcon().
+       * @param scale Optional. How many screen pixels wide each icon pixel is. A 35x35 icon fills the
+       *              button at the default of 2.
       */
-      void setButtonIcon(int ID, const bool icon[35][35]);
+      void setButtonIcon(int ID, const iconBitmap &icon, int scale = 2);
   
       /**
        * @brief Sets the title of the button. It will appear when the button is pressed.
@@ -126,20 +153,24 @@ namespace evAPI {
       void setDataDisplayTime(int time);
 
       /**
-       * @brief Prints all the buttons to the screen
+       * @brief Prints all the buttons to the screen. Only the parts of the screen that changed are redrawn.
       */
       void printButtons();
   
     private:
       //===== Button data =====
-      Button * buttonList[MAX_BUTTON_COUNT];  // List of all button objects in selector
-      AutoData * dataList[MAX_BUTTON_COUNT];  // List of all the data objects for the buttons;
-      int buttonIDList[MAX_BUTTON_COUNT];  // List of all button IDs in selector
-      int buttonCount;  // How many buttons there are
-      int highestID;  // What is the highest used ID
+      Button * buttonList[MAX_BUTTON_COUNT] = {};  // Button objects indexed by ID, nullptr if the ID isn't used
+      AutoData * dataList[MAX_BUTTON_COUNT] = {};  // Data objects for the buttons indexed by ID
+      int buttonPage[MAX_BUTTON_COUNT] = {};  // The page each button is on
+      int buttonCount = 0;  // How many buttons there are
+      int highestID = 0;  // What is the highest used ID
       int selectedButton = 0;  // The button that is currently selected
       bool doesButtonExist(int ID);  // Returns true if the button exists in the list
       int dataDisplayTime = 3000;  // How long the button data will be on the screen;
+      void getSlotPosition(int ID, int *x, int *y);  // Gets the position of the button slot an ID uses
+
+      //===== Drawing =====
+      ScreenBuffer screen;  // Off screen copy of the brain screen the buttons are drawn into
   
       //===== Page turning button stuff =====
       arrowIcons arrows;  // Structure with the arrow icons in it
@@ -147,29 +178,45 @@ namespace evAPI {
       Button * pageForward;  // Button to move to previous page
       int pageTurner;  // Used by page turn buttons to tell selector to go forward or back
       int selectedPage = 0;  // The page that is being shown
-      int highestUsedPage;  // The biggest page number that has buttons on it
+      int drawnPage = -1;  // The page that is currently in the screen buffer
+      int highestUsedPage = 0;  // The biggest page number that has buttons on it
       const vex::color availablePage = vex::color(150, 150, 150);  // Color of the page button if there is another page
       const vex::color nonavailablePage = vex::color(70, 70, 70);  // Color of the page button if there is not another page
       void printPageButtons();  // Prints the page turning buttons
   
+      //===== Touch hit testing =====
+      int8_t hitGrid[HIT_GRID_ROWS][HIT_GRID_COLUMNS][HIT_GRID_CELL_CAPACITY];  // IDs of the buttons touching each cell on the grid page, -1 if unused
+      int gridPage = -1;  // The page the hit grid was built for, -1 if it has to be rebuilt
+      void buildHitGrid();  // Fills the hit grid with the buttons on the selected page
+      int findButton(int x, int y);  // Returns the ID of the button at a point, -1 if there isn't one
+
       //===== Screen press and thread stuff =====
 
       /**
-       * @brief Starts the main thread for the Auto Selector UI
+       * @brief Draws the Auto Selector and starts listening for screen presses.
       */
       void startThread();
 
       void pressed();  // Called when the screen is pressed
-      
+      void queuePress();  // Starts the press thread if it isn't already running
+
+      /**
+       * @brief Called by the brain when the screen is pressed.
+      */
+      friend void screenPressedEvent();
+
       /**
-       * @brief Friend function that updates the screen when it is pressed.
+       * @brief Friend function that handles screen presses, then exits once there are none left.
        * @param thisContextRaw A pointer to a AutoSelector object.
       */
       friend void threadFunction(void *thisContextRaw);
 
       friend class vexUI; //Allow the vexUI class to access the startThread function
 
-      vex::thread * selectorThread;  // Looping thread for the selector to run
+      vex::mutex pressLock;  // Protects the press flags
+      bool pressPending = false;  // True if there is a press that hasn't been handled
+      bool handlingPress = false;  // True while the press thread is running
+      LoopProfiler pressProfiler = LoopProfiler("Auto Selector", 0);  // Timing of each handled press
      
   };
 }
@@ -3,6 +3,8 @@
 
 #include "../../../Common/include/evAPIBasicConfig.h"
 #include "../../../Common/include/evNamespace.h"
+#include "ScreenBuffer.h"
+#include "iconBitmap.h"
 
 namespace evAPI {
   class Button {
@@ -19,20 +21,27 @@ namespace evAPI {
       void setBorderColor(int r, int g, int b);  // Sets the border color to a RGB value
       void setBorderThickness(int thickness);  // Sets the thickness of the button border
 
-      void setButtonIcon(bool *iconArray, int xOffset, int yOffset);  // Pass in the icon array
+      void setButtonIcon(const iconBitmap &icon, int xOffset, int yOffset, int scale = 2);  // Pass in the icon and how many screen pixels each icon pixel takes up
 
       void setButtonPosition(int x, int y);  // Sets the position of the top left corner of the button
       void setButtonSize(int widthIN, int hightIN);  // Sets the size of the button
 
-      void drawButton(bool border);  // Draws the button with the option of adding the border
+      void drawButton(ScreenBuffer &screen, bool border);  // Draws the button into the screen buffer with the option of adding the border
       bool pressed(int xPress, int yPress);  // Call to tell the button the screen was pressed and tell it where
+      bool contains(int x, int y);  // Returns true if the point is on the button
+
+      int getX();  // Returns the x position of the top left corner
+      int getY();  // Returns the y position of the top left corner
+      int getWidth();  // Returns the width of the button
+      int getHeight();  // Returns the height of the button
 
     private:
       int buttonID;  // The number that will be passed to the data output when the button is pressed
       int *dataOuput;  // A pointer to the variable that the button will set with its ID when it is pressed
       void (*buttonCallback)(int);  // *Optional* The function that will be called when the button is pressed, passes the button ID
       bool hasCallback = false;  // If the button has a callback
-      bool *buttonIcon;  // *Optional* The array that is used to draw a monochrome 35x35 image on the button
+      const iconBitmap *buttonIcon;  // *Optional* The icon that is used to draw a monochrome image on the button
+      int iconScale = 2;  // Size of each icon pixel on the screen
       int xIconOffset = 0; //Offset for the icons x value
       int yIconOffset = 0; //Offset for the icons y value
       bool hasIcon = false;  // If the button has an icon
@@ -0,0 +1,69 @@
+#ifndef SCREENBUFFER_H_
+#define SCREENBUFFER_H_
+
+#include "../../../Common/include/evAPIBasicConfig.h"
+
+#define BRAIN_SCREEN_WIDTH 480
+#define BRAIN_SCREEN_HEIGHT 272
+#define BRAIN_SCREEN_BACKGROUND 0x000000
+
+namespace evAPI {
+  /**
+   * @brief An off screen copy of the brain screen. Drawing only changes the copy, and only marks
+   *        pixels that actually changed as dirty. flush() then sends the changed rows to the
+   *        screen with one drawImageFromBuffer call.
+  */
+  class ScreenBuffer {
+    public:
+      ScreenBuffer();
+
+      /**
+       * @brief Sets a single pixel.
+       * @param x The x position of the pixel.
+       * @param y The y position of the pixel.
+       * @param color The color as 0xRRGGBB.
+      */
+      void setPixel(int x, int y, uint32_t color);
+
+      /**
+       * @brief Fills a rectangle with a color. Parts outside the screen are skipped.
+       * @param x The x position of the top left corner.
+       * @param y The y position of the top left corner.
+       * @param width The width of the rectangle.
+       * @param height The height of the rectangle.
+       * @param color The color as 0xRRGGBB.
+      */
+      void fillRectangle(int x, int y, int width, int height, uint32_t color);
+
+      /**
+       * @brief Fills the entire buffer with a color.
+       * @param color The color as 0xRRGGBB.
+      */
+      void fill(uint32_t color);
+
+      /**
+       * @brief Marks the entire screen as dirty. Call this after drawing on the screen directly so the
+       *        next flush() puts the buffer back.
+      */
+      void invalidate();
+
+      /**
+       * @returns True if anything has changed since the last flush().
+      */
+      bool isDirty();
+
+      /**
+       * @brief Sends the changed rows to the brain screen.
+      */
+      void flush();
+
+    private:
+      uint32_t pixels[BRAIN_SCREEN_HEIGHT][BRAIN_SCREEN_WIDTH];  // Every pixel on the screen as 0xRRGGBB
+
+      int dirtyTop;  // First row that has changed, BRAIN_SCREEN_HEIGHT if nothing has changed
+      int dirtyBottom;  // Last row that has changed, -1 if nothing has changed
+      void markRowDirty(int y);  // Adds a row to the dirty area
+  };
+}
+
+#endif // SCREENBUFFER_H_
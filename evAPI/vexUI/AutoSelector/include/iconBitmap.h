@@ -0,0 +1,82 @@
+#ifndef ICONBITMAP_H_
+#define ICONBITMAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace evAPI {
+  /**
+   * @brief A monochrome icon stored with one bit per pixel. Bits go left to right, then top to
+   *        bottom, starting at the lowest bit of the first byte.
+  */
+  struct iconBitmap {
+    uint8_t width;  // Width of the icon in pixels
+    uint8_t height;  // Height of the icon in pixels
+    const uint8_t *bits;  // The packed pixels
+
+    /**
+     * @returns True if the pixel is set. Pixels outside the icon are never set.
+    */
+    bool getPixel(int x, int y) const {
+      if(x < 0 || x >= width || y < 0 || y >= height) {
+        return false;
+      }
+
+      int bit = (y * width) + x;
+      return (bits[bit >> 3] >> (bit & 7)) & 1;
+    }
+  };
+
+  //===== Compile time icon packing =====
+
+  /**
+   * @brief Packed bytes of an icon. Created by packIcon().
+  */
+  template<size_t N> struct iconBits {
+    uint8_t data[N];
+  };
+
+  template<size_t... I> struct iconIndexList {};
+
+  template<size_t N, size_t... I> struct makeIconIndexList : makeIconIndexList<N - 1, N - 1, I...> {};
+
+  template<size_t... I> struct makeIconIndexList<0, I...> {
+    typedef iconIndexList<I...> type;
+  };
+
+  /**
+   * @returns 1 if the character in the art is a '#', 0 otherwise.
+  */
+  constexpr uint8_t packIconBit(const char *art, size_t length, size_t index) {
+    return (index < length && art[index] == '#') ? 1 : 0;
+  }
+
+  /**
+   * @returns Eight pixels of the art packed into a byte.
+  */
+  constexpr uint8_t packIconByte(const char *art, size_t length, size_t byte) {
+    return packIconBit(art, length, (byte * 8) + 0) << 0 |
+           packIconBit(art, length, (byte * 8) + 1) << 1 |
+           packIconBit(art, length, (byte * 8) + 2) << 2 |
+           packIconBit(art, length, (byte * 8) + 3) << 3 |
+           packIconBit(art, length, (byte * 8) + 4) << 4 |
+           packIconBit(art, length, (byte * 8) + 5) << 5 |
+           packIconBit(art, length, (byte * 8) + 6) << 6 |
+           packIconBit(art, length, (byte * 8) + 7) << 7;
+  }
+
+  template<size_t... I> constexpr iconBits<sizeof...(I)> packIcon(const char *art, size_t length, iconIndexList<I...>) {
+    return iconBits<sizeof...(I)>{{packIconByte(art, length, I)...}};
+  }
+
+  /**
+   * @brief Packs text art into one bit per pixel at compile time. Each '#' is a set pixel, and any
+   *        other character is a clear pixel. The art has to be exactly width * height characters.
+   * @example constexpr auto arrowBits = packIcon<35, 35>(arrowArt);
+  */
+  template<size_t W, size_t H> constexpr iconBits<((W * H) + 7) / 8> packIcon(const char (&art)[(W * H) + 1]) {
+    return packIcon(art, W * H, typename makeIconIndexList<((W * H) + 7) / 8>::type());
+  }
+}
+
+#endif // ICONBITMAP_H_
@@ -3,6 +3,10 @@
 namespace evAPI {
   // This is the work around for the vex thread call not taking class members
   void threadFunction(void *thisContextRaw);  // Function that is run in the thread
+  void screenPressedEvent();  // Function that is run when the screen is pressed
+
+  // The brain's screen events don't take an argument, so the selector they go to is stored here
+  static AutoSelector *touchSelector = nullptr;
 
   AutoSelector::AutoSelector() {  // Constructor to set up page turning buttons
     pageBack = new Button(-1, &pageTurner);
@@ -11,8 +15,8 @@ namespace evAPI {
     pageBack->setButtonSize(60, 30);
     pageForward->setButtonPosition(255, 200);
     pageForward->setButtonSize(60, 30);
-    pageBack->setButtonIcon((bool*)arrows.previousPageArrow, 0, 0);
-    pageForward->setButtonIcon((bool*)arrows.nextPageArrow, 0, 0);
+    pageBack->setButtonIcon(arrows.previousPageArrow, 0, 0);
+    pageForward->setButtonIcon(arrows.nextPageArrow, 0, 0);
   }
 
   int AutoSelector::getSelectedButton() {  // Returns the selectedButton
@@ -21,7 +25,7 @@ namespace evAPI {
 
   std::string AutoSelector::getSelectedButtonTitle()
   {
-    if(dataList[selectedButton] == nullptr)
+    if(!doesButtonExist(selectedButton))
     {
       return std::string("");
     }
@@ -37,83 +41,63 @@ namespace evAPI {
     selectedPage = page;
   }
 
-  int AutoSelector::addButton(int ID, int r, int g, int b) {  // Adds a button with the set ID and RGB color. Returns button count
-      bool buttonExits = doesButtonExist(ID);
-
-    if(!buttonExits) {
-      int pgIndex = ID % 8;  // Position of the button on the screen
-      int xIndex = pgIndex % 4;  // How many places from the left the button is
-      buttonIDList[buttonCount] = ID;  // Adds the ID to the list of used IDs
-      buttonList[ID] = new Button(ID, &selectedButton);  // Adds the button to the list of button objects
-      dataList[ID] = new AutoData;  // Creates a blank data object and adds it to the list
-
-      if(pgIndex >= 0 && pgIndex <= 3) {  // Sets up the position and size of the new button. Hard coded for 2 rows 4 columns
-        buttonList[ID]->setButtonPosition(((40 * (xIndex + 1)) + xIndex * 70), 20);
-        buttonList[ID]->setButtonSize(70, 70);
-      } else if(pgIndex >= 4 && pgIndex <= 7) {
-        buttonList[ID]->setButtonPosition(((40 * (xIndex + 1)) + xIndex * 70), 115);
-        buttonList[ID]->setButtonSize(70, 70);
-      }
-  
-      buttonList[ID]->setBorderColor(vex::color::white);
-      buttonList[ID]->setBorderThickness(7);
-      buttonList[ID]->setButtonColor(r, g, b);
+  void AutoSelector::setButtonLayout(int ID, int page, int x, int y, int width, int height) {  // Moves a button to any page and place
+    if(doesButtonExist(ID)) {
+      buttonList[ID]->setButtonPosition(x, y);
+      buttonList[ID]->setButtonSize(width, height);
+      buttonPage[ID] = page;
 
-      // Checks if the added button is on a new page
-      if(ID / 8 > highestUsedPage) {
-        highestUsedPage = ID / 8;
-      }
-      if(ID > highestID) {
-        highestID = ID;
+      if(page > highestUsedPage) {
+        highestUsedPage = page;
       }
 
-      buttonCount++;
-      return(buttonCount);
-    } else {
-      return(0);
+      // The layout changed, so the hit grid and screen have to be redone
+      gridPage = -1;
+      drawnPage = -1;
     }
   }
 
+  int AutoSelector::addButton(int ID, int r, int g, int b) {  // Adds a button with the set ID and RGB color. Returns button count
+    return addButton(ID, vex::color(r, g, b));
+  }
+
   int AutoSelector::addButton(int ID, uint32_t buttonColor)
   {
     return addButton(ID, vex::color(buttonColor));
   }
 
   int AutoSelector::addButton(int ID, vex::color buttonColor) {  // Adds a button with the set ID and vex color object. Returns button count
-    bool buttonExits = doesButtonExist(ID);
-
-    if(!buttonExits) {
-      int pgIndex = ID % 8;  // Position of the button on the screen
-      int xIndex = pgIndex % 4;  // How many places from the left the button is
-      buttonIDList[buttonCount] = ID;  // Adds the ID to the list of used IDs
-      buttonList[ID] = new Button(ID, &selectedButton);  // Adds the button to the list of button objects
-      dataList[ID] = new AutoData;  // Creates a blank data object and adds it to the list
-
-      if(pgIndex >= 0 && pgIndex <= 3) {  // Sets up the position and size of the new button. Hard coded for 2 rows 4 columns
-        buttonList[ID]->setButtonPosition(((40 * (xIndex + 1)) + xIndex * 70), 20);
-        buttonList[ID]->setButtonSize(70, 70);
-      } else if(pgIndex >= 4 && pgIndex <= 7) {
-        buttonList[ID]->setButtonPosition(((40 * (xIndex + 1)) + xIndex * 70), 115);
-        buttonList[ID]->setButtonSize(70, 70);
-      }
+    if(ID < 0 || ID >= MAX_BUTTON_COUNT || doesButtonExist(ID)) {
+      return(0);
+    }
 
-      buttonList[ID]->setBorderColor(vex::color::white);
-      buttonList[ID]->setBorderThickness(7);
-      buttonList[ID]->setButtonColor(buttonColor);
+    buttonList[ID] = new Button(ID, &selectedButton);  // Adds the button to the list of button objects
+    dataList[ID] = new AutoData;  // Creates a blank data object and adds it to the list
 
-      // Checks if the added button is on a new page
-      if(ID / 8 > highestUsedPage) {
-        highestUsedPage = ID / 8;
-      }
-      if(ID > highestID) {
-        highestID = ID;
-      }
+    // Sets up the default position and size of the new button
+    int x, y;
+    getSlotPosition(ID, &x, &y);
+    buttonList[ID]->setButtonPosition(x, y);
+    buttonList[ID]->setButtonSize(70, 70);
+    buttonPage[ID] = ID / 8;
 
-      buttonCount++;
-      return(buttonCount);
-    } else {
-      return(0);
+    buttonList[ID]->setBorderColor(vex::color::white);
+    buttonList[ID]->setBorderThickness(7);
+    buttonList[ID]->setButtonColor(buttonColor);
+
+    // Checks if the added button is on a new page
+    if(buttonPage[ID] > highestUsedPage) {
+      highestUsedPage = buttonPage[ID];
+    }
+    if(ID > highestID) {
+      highestID = ID;
     }
+
+    // The hit grid has to be rebuilt with the new button
+    gridPage = -1;
+
+    buttonCount++;
+    return(buttonCount);
   }
 
   void AutoSelector::setButtonFunction(int ID, void (*callback)(int)) {  // Sets a function the button will run when pressed
@@ -134,35 +118,30 @@ namespace evAPI {
     }
   }
 
-  void AutoSelector::setButtonIcon(int ID, const bool icon[35][35]) {  // Changes the icon array of the button
+  void AutoSelector::setButtonIcon(int ID, const iconBitmap &icon, int scale) {  // Changes the icon of the button
     if(doesButtonExist(ID)) {
-      buttonList[ID]->setButtonIcon((bool*)icon, -2, -2);
+      buttonList[ID]->setButtonIcon(icon, -2, -2, scale);
     }
   }
 
   void AutoSelector::printButtons() {  // Prints all the buttons to the screen
-    printPageButtons();
-    // Records the ID of all the buttons on the screen
-    int buttonsOnPage[] = {-1, -1, -1, -1, -1, -1, -1, -1};  // List will be filled with all the ID of the buttons being used
-    int headPos = 0;
-    for(int i = selectedPage * 8; i <= (selectedPage * 8) + 7; i++) {
-      if(doesButtonExist(i)) {
-        buttonsOnPage[headPos] = i;
-        headPos++;
-      }
+    // Clear the old page out of the screen buffer when the page changes
+    if(drawnPage != selectedPage) {
+      screen.fill(BRAIN_SCREEN_BACKGROUND);
+      drawnPage = selectedPage;
     }
 
-    // Draws all the buttons
-    for(int i = 0; i < 8; i++) {
-      if(buttonsOnPage[i] != -1) {
-        if(selectedButton == buttonsOnPage[i]) {
-          buttonList[buttonsOnPage[i]]->drawButton(true);
-        } else {
-          buttonList[buttonsOnPage[i]]->drawButton(false);
-        }
+    printPageButtons();
+
+    // Draws all the buttons on the page into the screen buffer
+    for(int i = 0; i <= highestID; i++) {
+      if(doesButtonExist(i) && buttonPage[i] == selectedPage) {
+        buttonList[i]->drawButton(screen, selectedButton == i);
       }
     }
 
+    // Only send the parts of the screen that changed
+    screen.flush();
   }
 
   void AutoSelector::setButtonTitle(int ID, const char title[MAX_TITLE_LENGTH]) {  // Sets a button's title
@@ -181,18 +160,80 @@ namespace evAPI {
     dataDisplayTime = time;
   }
 
-  void AutoSelector::startThread() {  // Starts the main loop thread for the auto selector
+  void AutoSelector::startThread() {  // Draws the selector and starts listening for screen presses
     printButtons();
-    selectorThread = new vex::thread(threadFunction, this);
+    touchSelector = this;
+    Brain.Screen.pressed(screenPressedEvent);
   }
 
   // ------------------ PRIVATE ---------------------------
   bool AutoSelector::doesButtonExist(int ID) {  // Returns true if the button exists in the list
-    bool buttonExits = false;
-    for(int i = 0; i < buttonCount; i++) {  // Run through all existing button IDs to see if the passed in ID is being used
-      if(buttonIDList[i] == ID) buttonExits = true;
+    return (ID >= 0) && (ID < MAX_BUTTON_COUNT) && (buttonList[ID] != nullptr);
+  }
+
+  void AutoSelector::buildHitGrid() {  // Fills the hit grid with the buttons on the selected page
+    memset(hitGrid, -1, sizeof(hitGrid));
+
+    for(int ID = 0; ID <= highestID; ID++) {
+      if(!doesButtonExist(ID) || buttonPage[ID] != selectedPage) {
+        continue;
+      }
+
+      // Find the cells the button touches
+      Button *button = buttonList[ID];
+      int firstColumn = button->getX() / HIT_GRID_CELL_SIZE;
+      int lastColumn = (button->getX() + button->getWidth()) / HIT_GRID_CELL_SIZE;
+      int firstRow = button->getY() / HIT_GRID_CELL_SIZE;
+      int lastRow = (button->getY() + button->getHeight()) / HIT_GRID_CELL_SIZE;
+
+      firstColumn = firstColumn < 0 ? 0 : firstColumn;
+      firstRow = firstRow < 0 ? 0 : firstRow;
+      lastColumn = lastColumn >= HIT_GRID_COLUMNS ? HIT_GRID_COLUMNS - 1 : lastColumn;
+      lastRow = lastRow >= HIT_GRID_ROWS ? HIT_GRID_ROWS - 1 : lastRow;
+
+      // Add the button to the first free spot in each cell
+      for(int row = firstRow; row <= lastRow; row++) {
+        for(int column = firstColumn; column <= lastColumn; column++) {
+          for(int i = 0; i < HIT_GRID_CELL_CAPACITY; i++) {
+            if(hitGrid[row][column][i] == -1) {
+              hitGrid[row][column][i] = ID;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    gridPage = selectedPage;
+  }
+
+  int AutoSelector::findButton(int x, int y) {  // Returns the ID of the button at a point, -1 if there isn't one
+    if(x < 0 || x >= BRAIN_SCREEN_WIDTH || y < 0 || y >= BRAIN_SCREEN_HEIGHT) {
+      return -1;
+    }
+
+    if(gridPage != selectedPage) {
+      buildHitGrid();
     }
-    return(buttonExits);
+
+    // Only the few buttons in the pressed cell have to be checked
+    int8_t *cell = hitGrid[y / HIT_GRID_CELL_SIZE][x / HIT_GRID_CELL_SIZE];
+
+    for(int i = 0; i < HIT_GRID_CELL_CAPACITY && cell[i] != -1; i++) {
+      if(buttonList[cell[i]]->contains(x, y)) {
+        return cell[i];
+      }
+    }
+
+    return -1;
+  }
+
+  void AutoSelector::getSlotPosition(int ID, int *x, int *y) {  // Gets the position of the button slot an ID uses
+    int pgIndex = ID % 8;  // Position of the button on the screen
+    int xIndex = pgIndex % 4;  // How many places from the left the button is
+
+    *x = (40 * (xIndex + 1)) + xIndex * 70;  // Hard coded for 2 rows 4 columns
+    *y = (pgIndex <= 3) ? 20 : 115;
   }
 
   void AutoSelector::printPageButtons() {  // Prints the page turning buttons
@@ -212,38 +253,31 @@ namespace evAPI {
     pageBack->setBorderThickness(1);
     pageForward->setBorderThickness(1);
 
-    pageBack->drawButton(true);
-    pageForward->drawButton(true);
+    pageBack->drawButton(screen, true);
+    pageForward->drawButton(screen, true);
   }
 
   void AutoSelector::pressed() {  // Called when the screen is pressed
     int xPos = Brain.Screen.xPosition();  // X position of where the button was pressed
     int yPos = Brain.Screen.yPosition();  // Y position of where the button was pressed
 
-    // Records the ID of all the buttons on the screen
-    int buttonsOnPage[8] = {-1, -1, -1, -1, -1, -1, -1, -1};  // List will be filled with all the ID of the buttons being used
-    int headPos = 0;
-    for(int i = selectedPage * 8; i <= (selectedPage * 8) + 7; i++) {
-      if(doesButtonExist(i)) {
-        buttonsOnPage[headPos] = i;
-        headPos++;
-      }
-    }
-
     int prePressButton = selectedButton;
 
-    // Passes pressed location to all buttons
-    for(int i = 0; i < 8; i++) {
-      if(buttonsOnPage[i] != -1) {
-        buttonList[buttonsOnPage[i]]->pressed(xPos, yPos);
-      }
+    // Passes the pressed location to the button that was pressed
+    int pressedButton = findButton(xPos, yPos);
+
+    if(pressedButton != -1) {
+      buttonList[pressedButton]->pressed(xPos, yPos);
     }
 
-    Brain.Screen.clearScreen();
     if(prePressButton != selectedButton) {
+      Brain.Screen.clearScreen();
       if(dataList[selectedButton]->printButtonData()) {
         vex::task::sleep(dataDisplayTime);
       }
+
+      // The data was drawn on the screen directly, so all of the buffer has to be sent again
+      screen.invalidate();
     }
 
     if(selectedPage != 0) {
@@ -255,21 +289,56 @@ namespace evAPI {
     selectedPage += pageTurner;
     pageTurner = 0;
 
-    Brain.Screen.clearScreen();
     printButtons();
 
   }
 
+  void AutoSelector::queuePress() {  // Starts the press thread if it isn't already running
+    // Ignore the screen during a match so the control loops get the CPU
+    if(isConnectToField() && Competition.isEnabled()) {
+      return;
+    }
+
+    pressLock.lock();
+    pressPending = true;
+    bool startPressThread = !handlingPress;
+    handlingPress = true;
+    pressLock.unlock();
+
+    // The thread only exists while there are presses to handle
+    if(startPressThread) {
+      vex::thread(threadFunction, this).detach();
+    }
+  }
+
+  void screenPressedEvent() {  // Called by the brain when the screen is pressed
+    if(touchSelector != nullptr) {
+      touchSelector->queuePress();
+    }
+  }
+
   void threadFunction(void *thisContextRaw) {  // Function that is run in the thread
-    static bool prePressState;
     AutoSelector *thisContext = (AutoSelector*)thisContextRaw;
+    int taskID = taskManager.addCurrentTask(taskRole::UI, "Auto Selector");
 
     while(1) {
-      if(Brain.Screen.pressing() && !prePressState) {
-        thisContext->pressed();
+      // Exit once every press has been handled
+      thisContext->pressLock.lock();
+      if(!thisContext->pressPending) {
+        thisContext->handlingPress = false;
+        thisContext->pressLock.unlock();
+        break;
       }
-      prePressState = Brain.Screen.pressing();
-      vex::this_thread::sleep_for(50);
+      thisContext->pressPending = false;
+      thisContext->pressLock.unlock();
+
+      taskManager.beginWork(taskID);
+      thisContext->pressProfiler.beginLoop();
+      thisContext->pressed();
+      thisContext->pressProfiler.endLoop();
+      taskManager.endWork(taskID);
     }
+
+    taskManager.removeTask(taskID);
   }
 } // namespace evAPI
\ No newline at end of file
@@ -39,8 +39,9 @@ namespace evAPI {
     borderThickness = thickness;
   }
 
-  void Button::setButtonIcon(bool *iconArray, int xOffset, int yOffset) { // Pass in the icon array
-    buttonIcon = iconArray;
+  void Button::setButtonIcon(const iconBitmap &icon, int xOffset, int yOffset, int scale) { // Pass in the icon and its scale
+    buttonIcon = &icon;
+    iconScale = scale < 1 ? 1 : scale;
     xIconOffset = xOffset;
     yIconOffset = yOffset;
     hasIcon = true;
@@ -56,56 +57,55 @@ namespace evAPI {
     hight = hightIN;
   }
 
-  void Button::drawButton(bool border) {  // Draws the button with the option of adding the borderButton
-    //Draw the button with the appropriate color
-    Brain.Screen.setPenColor(vex::color::transparent); 
-    Brain.Screen.setFillColor(buttonColor);
-    Brain.Screen.drawRectangle(xPos, yPos, width, hight);
-
-    //*Draw the icon if the button has one
-    if(hasIcon)
-    {
-      //Loop over every single pixel in the image
-      for(int yInc = 0; yInc < floor(hight / 2); yInc++)
-      {
-        for(int xInc = 0; xInc < floor(width / 2); xInc++)
-        {
-          //Set the tile color based on the boolean array
-          if(buttonIcon[(yInc * 35) + xInc] == 1)
-          {
-            Brain.Screen.setPenColor(vex::color::black);
+  void Button::drawButton(ScreenBuffer &screen, bool border) {  // Draws the button into the screen buffer with the option of adding the border
+    uint32_t fillColor = buttonColor.rgb();
+    uint32_t iconColor = vex::color::black.rgb();
+    uint32_t borderColor = buttonBorderColor.rgb();
+
+    //*Find the area of the border. It is centered on the edge of the button.
+    int borderX = xPos + xIconOffset;
+    int borderY = yPos + yIconOffset;
+    int outerOffset = borderThickness / 2;  // How far the border goes outside the edge
+    int innerOffset = borderThickness - outerOffset;  // How far the border goes inside the edge
+
+    int borderLeft = borderX - outerOffset;
+    int borderTop = borderY - outerOffset;
+    int borderRight = borderX + width + outerOffset;
+    int borderBottom = borderY + hight + outerOffset;
+
+    //*Area that is drawn. The border area is always drawn so an old border gets erased.
+    int left = xPos < borderLeft ? xPos : borderLeft;
+    int top = yPos < borderTop ? yPos : borderTop;
+    int right = (xPos + width) > borderRight ? (xPos + width) : borderRight;
+    int bottom = (yPos + hight) > borderBottom ? (yPos + hight) : borderBottom;
+
+    //*Draw every pixel once so pixels that don't change aren't marked dirty
+    for(int y = top; y < bottom; y++) {
+      for(int x = left; x < right; x++) {
+        bool inBorder = border &&
+                        (x >= borderLeft && x < borderRight && y >= borderTop && y < borderBottom) &&
+                        !(x >= borderX + innerOffset && x < borderX + width - innerOffset &&
+                          y >= borderY + innerOffset && y < borderY + hight - innerOffset);
+        bool inButton = x >= xPos && x < xPos + width && y >= yPos && y < yPos + hight;
+
+        if(inBorder) {
+          screen.setPixel(x, y, borderColor);
+        } else if(inButton) {
+          //Each icon pixel covers a iconScale by iconScale square
+          if(hasIcon && buttonIcon->getPixel((x - xPos) / iconScale, (y - yPos) / iconScale)) {
+            screen.setPixel(x, y, iconColor);
+          } else {
+            screen.setPixel(x, y, fillColor);
           }
-
-          else
-          {
-            Brain.Screen.setPenColor(buttonColor);
-          }
-
-          //Draw the pixels on the screen
-          Brain.Screen.drawPixel(xPos + (xInc * 2), yPos + (yInc * 2));
-          Brain.Screen.drawPixel((xPos + (xInc * 2)) + 1, yPos + (yInc * 2));
-          Brain.Screen.drawPixel(xPos + (xInc * 2), (yPos + (yInc * 2)) + 1);
-          Brain.Screen.drawPixel((xPos + (xInc * 2)) + 1, (yPos + (yInc * 2)) + 1);
+        } else {
+          screen.setPixel(x, y, BRAIN_SCREEN_BACKGROUND);
         }
       }
     }
-
-    //*Draw the boarder if the button is selected
-    if(border)
-    {
-      //Setup pen parameters
-      Brain.Screen.setFillColor(vex::color::transparent);
-      Brain.Screen.setPenColor(buttonBorderColor);
-      Brain.Screen.setPenWidth(borderThickness);
-      
-      //Draw the boarder
-      Brain.Screen.drawRectangle(xPos + xIconOffset, yPos + yIconOffset, width, hight);
-    }  
   }
 
   bool Button::pressed(int xPress, int yPress) {  // Call to tell the button the screen was pressed and tell it whereButton
-    if(((xPress > xPos) && (xPress < xPos + width)) &&
-       ((yPress > yPos) && (yPress < yPos + hight))) {
+    if(contains(xPress, yPress)) {
       
       *dataOuput = buttonID;
 
@@ -118,4 +118,25 @@ namespace evAPI {
       return(0);
     }
   }
+
+  bool Button::contains(int x, int y) {  // Returns true if the point is on the button
+    return ((x > xPos) && (x < xPos + width)) &&
+           ((y > yPos) && (y < yPos + hight));
+  }
+
+  int Button::getX() {  // Returns the x position of the top left corner
+    return xPos;
+  }
+
+  int Button::getY() {  // Returns the y position of the top left corner
+    return yPos;
+  }
+
+  int Button::getWidth() {  // Returns the width of the button
+    return width;
+  }
+
+  int Button::getHeight() {  // Returns the height of the button
+    return hight;
+  }
 } // namespace evAPI
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "../include/ScreenBuffer.h"
+
+namespace evAPI {
+  ScreenBuffer::ScreenBuffer() {  // Starts with the buffer black and the whole screen dirty
+    memset(pixels, 0, sizeof(pixels));
+    invalidate();
+  }
+
+  void ScreenBuffer::setPixel(int x, int y, uint32_t color) {  // Sets a single pixel
+    if(x < 0 || x >= BRAIN_SCREEN_WIDTH || y < 0 || y >= BRAIN_SCREEN_HEIGHT) {
+      return;
+    }
+
+    if(pixels[y][x] != color) {
+      pixels[y][x] = color;
+      markRowDirty(y);
+    }
+  }
+
+  void ScreenBuffer::fillRectangle(int x, int y, int width, int height, uint32_t color) {  // Fills a rectangle with a color
+    //Clip the rectangle to the screen
+    int left = x < 0 ? 0 : x;
+    int top = y < 0 ? 0 : y;
+    int right = (x + width) > BRAIN_SCREEN_WIDTH ? BRAIN_SCREEN_WIDTH : (x + width);
+    int bottom = (y + height) > BRAIN_SCREEN_HEIGHT ? BRAIN_SCREEN_HEIGHT : (y + height);
+
+    for(int row = top; row < bottom; row++) {
+      bool rowChanged = false;
+
+      for(int column = left; column < right; column++) {
+        if(pixels[row][column] != color) {
+          pixels[row][column] = color;
+          rowChanged = true;
+        }
+      }
+
+      if(rowChanged) {
+        markRowDirty(row);
+      }
+    }
+  }
+
+  void ScreenBuffer::fill(uint32_t color) {  // Fills the entire buffer with a color
+    fillRectangle(0, 0, BRAIN_SCREEN_WIDTH, BRAIN_SCREEN_HEIGHT, color);
+  }
+
+  void ScreenBuffer::invalidate() {  // Marks the entire screen as dirty
+    dirtyTop = 0;
+    dirtyBottom = BRAIN_SCREEN_HEIGHT - 1;
+  }
+
+  bool ScreenBuffer::isDirty() {  // Returns true if anything has changed since the last flush
+    return dirtyBottom >= dirtyTop;
+  }
+
+  void ScreenBuffer::flush() {  // Sends the changed rows to the brain screen
+    if(!isDirty()) {
+      return;
+    }
+
+    //Full rows are next to each other in memory, so the changed rows can be sent in one call
+    Brain.Screen.drawImageFromBuffer(pixels[dirtyTop], 0, dirtyTop, BRAIN_SCREEN_WIDTH, dirtyBottom - dirtyTop + 1);
+
+    dirtyTop = BRAIN_SCREEN_HEIGHT;
+    dirtyBottom = -1;
+  }
+
+  // ------------------ PRIVATE ---------------------------
+  void ScreenBuffer::markRowDirty(int y) {  // Adds a row to the dirty area
+    if(y < dirtyTop) {
+      dirtyTop = y;
+    }
+
+    if(y > dirtyBottom) {
+      dirtyBottom = y;
+    }
+  }
+} // namespace evAPI
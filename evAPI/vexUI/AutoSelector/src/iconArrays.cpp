@@ -0,0 +1,628 @@
+#include "../include/iconArrays.h"
+
+namespace evAPI {
+  //===== Icon art. '#' is a black pixel, '.' is the button color. =====
+
+  static constexpr char exclamationMarkArt[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    "..................................."
+    "..................................."
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    ".....####......####......####......"
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number0Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "............############..........."
+    "............############..........."
+    "............############..........."
+    "............############..........."
+    "............###......###..........."
+    "............###......###..........."
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    "............###......###..........."
+    "............###......###..........."
+    "............###......###..........."
+    "............############..........."
+    "............############..........."
+    "............############..........."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number1Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...............######.............."
+    "...............######.............."
+    "...............######.............."
+    "............#########.............."
+    "............#########.............."
+    "............#########.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number2Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...........############............"
+    "...........############............"
+    "...........############............"
+    "........###............###........."
+    "........###............###........."
+    "........###............###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    "....................###............"
+    "....................###............"
+    "....................###............"
+    ".................###..............."
+    ".................###..............."
+    ".................###..............."
+    "..............###.................."
+    "..............###.................."
+    "..............###.................."
+    "...........###....................."
+    "...........###....................."
+    "...........###....................."
+    "........##################........."
+    "........##################........."
+    "........##################........."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number3Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...........############............"
+    "...........############............"
+    "...........############............"
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    "....................######........."
+    "....................######........."
+    "....................######........."
+    "..............#########............"
+    "..............#########............"
+    "..............#########............"
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    ".......................###........."
+    "........###############............"
+    "........###############............"
+    "........###############............"
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number4Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................######.........."
+    "...................######.........."
+    "...................######.........."
+    "...................######.........."
+    "...................######.........."
+    "...................######.........."
+    "................###...###.........."
+    "................###...###.........."
+    "................###...###.........."
+    ".............###......###.........."
+    ".............###......###.........."
+    ".............###......###.........."
+    "..........###.........###.........."
+    "..........###.........###.........."
+    "..........###.........###.........."
+    ".......######.........###.........."
+    ".......######.........###.........."
+    ".......######.........###.........."
+    ".......#####################......."
+    ".......#####################......."
+    ".......#####################......."
+    "......................###.........."
+    "......................###.........."
+    "......................###.........."
+    "......................###.........."
+    "......................###.........."
+    "......................###.........."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number5Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    ".............############.........."
+    ".............############.........."
+    ".............############.........."
+    ".............###..................."
+    ".............###..................."
+    ".............###..................."
+    ".............###..................."
+    ".............###..................."
+    ".............###..................."
+    ".............############.........."
+    ".............############.........."
+    ".............############.........."
+    "......................######......."
+    "......................######......."
+    "......................######......."
+    ".........................###......."
+    ".........................###......."
+    ".........................###......."
+    ".........................###......."
+    ".........................###......."
+    ".........................###......."
+    "..........###.........######......."
+    "..........###.........######......."
+    "..........###.........######......."
+    ".............############.........."
+    ".............############.........."
+    ".............############.........."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number6Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    ".............#########............."
+    ".............#########............."
+    ".............#########............."
+    "..........###......................"
+    "..........###......................"
+    "..........###......................"
+    ".......###........................."
+    ".......###........................."
+    ".......###........................."
+    ".......###...#########............."
+    ".......###...#########............."
+    ".......###...#########............."
+    ".......######.........###.........."
+    ".......######.........###.........."
+    ".......######.........###.........."
+    ".......###............###.........."
+    ".......###............###.........."
+    ".......###............###.........."
+    ".......###............###.........."
+    ".......###............###.........."
+    ".......###............###.........."
+    "..........###......######.........."
+    "..........###......######.........."
+    "..........###......######.........."
+    "..........############............."
+    "..........############............."
+    "..........############............."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number7Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    ".........##################........"
+    ".........##################........"
+    ".........##################........"
+    "........................###........"
+    "........................###........"
+    "........................###........"
+    ".....................###..........."
+    ".....................###..........."
+    ".....................###..........."
+    ".....................###..........."
+    ".....................###..........."
+    ".....................###..........."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "..................###.............."
+    "...............######.............."
+    "...............######.............."
+    "...............######.............."
+    "...............###................."
+    "...............###................."
+    "...............###................."
+    "............######................."
+    "............######................."
+    "............######................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number8Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "............############..........."
+    "............############..........."
+    "............############..........."
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    "............###......###..........."
+    "............###......###..........."
+    "............###......###..........."
+    "............############..........."
+    "............############..........."
+    "............############..........."
+    ".........###.........######........"
+    ".........###.........######........"
+    ".........###.........######........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    "............############..........."
+    "............############..........."
+    "............############..........."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char number9Art[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "............############..........."
+    "............############..........."
+    "............############..........."
+    ".........###.........###..........."
+    ".........###.........###..........."
+    ".........###.........###..........."
+    ".........###............###........"
+    ".........###............###........"
+    ".........###............###........"
+    ".........###.........######........"
+    ".........###.........######........"
+    ".........###.........######........"
+    "............#########...###........"
+    "............#########...###........"
+    "............#########...###........"
+    "........................###........"
+    "........................###........"
+    "........................###........"
+    ".....................######........"
+    ".....................######........"
+    ".....................######........"
+    ".....................###..........."
+    ".....................###..........."
+    ".....................###..........."
+    "............#########.............."
+    "............#########.............."
+    "............#########.............."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char leftArrowArt[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..............###.................."
+    ".............####.................."
+    "............#####.................."
+    "...........#####..................."
+    "..........#####...................."
+    ".........#####....................."
+    "........#####......................"
+    ".......#####......................."
+    "......#####........................"
+    ".....##########################...."
+    ".....##########################...."
+    ".....##########################...."
+    "......#####........................"
+    ".......#####......................."
+    "........#####......................"
+    ".........#####....................."
+    "..........#####...................."
+    "...........#####..................."
+    "............#####.................."
+    ".............####.................."
+    "..............###.................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char rightArrowArt[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................###.............."
+    "..................####............."
+    "..................#####............"
+    "...................#####..........."
+    "....................#####.........."
+    ".....................#####........."
+    "......................#####........"
+    ".......................#####......."
+    "........................#####......"
+    "....##########################....."
+    "....##########################....."
+    "....##########################....."
+    "........................#####......"
+    ".......................#####......."
+    "......................#####........"
+    ".....................#####........."
+    "....................#####.........."
+    "...................#####..........."
+    "..................#####............"
+    "..................####............."
+    "..................###.............."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char skillsArt[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..............#######.............."
+    "............############..........."
+    "..........###############.........."
+    ".........#################........."
+    ".........##################........"
+    ".........#####........######......."
+    "........#####..........#####......."
+    "........#####..........#####......."
+    "........#####...........###........"
+    "........#####......................"
+    "........########..................."
+    ".........##########................"
+    "..........#############............"
+    "...........###############........."
+    "..............#############........"
+    ".................###########......."
+    ".....................#######......."
+    ".......................######......"
+    ".........##.............#####......"
+    "........####.............####......"
+    "........####.............####......"
+    "........#####...........#####......"
+    "........#####...........####......."
+    "........#######.......######......."
+    ".........##################........"
+    "..........#################........"
+    "...........##############.........."
+    "..............######..............."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  /* static constexpr char iconTestArt[] =
+    "###################################"
+    "##...............................##"
+    "#.#.............................#.#"
+    "#..#...........................#..#"
+    "#...#.........................#...#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#.................................#"
+    "#...#.........................#...#"
+    "#..#...........................#..#"
+    "#.#.............................#.#"
+    "##...............................##"
+    "###################################"; */
+
+  /* static constexpr char blankArt[] =
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."; */
+
+  //===== Packed icons =====
+  static constexpr auto exclamationMarkBits = packIcon<35, 35>(exclamationMarkArt);
+  static constexpr auto number0Bits = packIcon<35, 35>(number0Art);
+  static constexpr auto number1Bits = packIcon<35, 35>(number1Art);
+  static constexpr auto number2Bits = packIcon<35, 35>(number2Art);
+  static constexpr auto number3Bits = packIcon<35, 35>(number3Art);
+  static constexpr auto number4Bits = packIcon<35, 35>(number4Art);
+  static constexpr auto number5Bits = packIcon<35, 35>(number5Art);
+  static constexpr auto number6Bits = packIcon<35, 35>(number6Art);
+  static constexpr auto number7Bits = packIcon<35, 35>(number7Art);
+  static constexpr auto number8Bits = packIcon<35, 35>(number8Art);
+  static constexpr auto number9Bits = packIcon<35, 35>(number9Art);
+  static constexpr auto leftArrowBits = packIcon<35, 35>(leftArrowArt);
+  static constexpr auto rightArrowBits = packIcon<35, 35>(rightArrowArt);
+  static constexpr auto skillsBits = packIcon<35, 35>(skillsArt);
+
+  const iconBitmap defaultIconArrays::exclamationMark = {35, 35, exclamationMarkBits.data};
+  const iconBitmap defaultIconArrays::number0 = {35, 35, number0Bits.data};
+  const iconBitmap defaultIconArrays::number1 = {35, 35, number1Bits.data};
+  const iconBitmap defaultIconArrays::number2 = {35, 35, number2Bits.data};
+  const iconBitmap defaultIconArrays::number3 = {35, 35, number3Bits.data};
+  const iconBitmap defaultIconArrays::number4 = {35, 35, number4Bits.data};
+  const iconBitmap defaultIconArrays::number5 = {35, 35, number5Bits.data};
+  const iconBitmap defaultIconArrays::number6 = {35, 35, number6Bits.data};
+  const iconBitmap defaultIconArrays::number7 = {35, 35, number7Bits.data};
+  const iconBitmap defaultIconArrays::number8 = {35, 35, number8Bits.data};
+  const iconBitmap defaultIconArrays::number9 = {35, 35, number9Bits.data};
+  const iconBitmap defaultIconArrays::leftArrow = {35, 35, leftArrowBits.data};
+  const iconBitmap defaultIconArrays::rightArrow = {35, 35, rightArrowBits.data};
+  const iconBitmap defaultIconArrays::skills = {35, 35, skillsBits.data};
+} // namespace evAPI
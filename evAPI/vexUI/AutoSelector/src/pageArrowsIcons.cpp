@@ -0,0 +1,86 @@
+#include "../include/pageArrowsIcons.h"
+
+namespace evAPI {
+  //===== Icon art. '#' is a black pixel, '.' is the button color. =====
+
+  static constexpr char nextPageArrowArt[] =
+    "..............................#...."
+    "..............................#...."
+    "...............##.............#...."
+    "..............####............#...."
+    "..............#####...........#...."
+    "..............######..........#...."
+    ".........############.........#...."
+    ".........#############........#...."
+    ".........############.........#...."
+    "..............######..........#...."
+    "..............#####...........#...."
+    "..............####............#...."
+    "...............##.............#...."
+    "..............................#...."
+    "..............................#...."
+    "###############################...."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  static constexpr char previousPageArrowArt[] =
+    "..............................#...."
+    "..............................#...."
+    ".............##...............#...."
+    "............####..............#...."
+    "...........#####..............#...."
+    "..........######..............#...."
+    ".........############.........#...."
+    "........#############.........#...."
+    ".........############.........#...."
+    "..........######..............#...."
+    "...........#####..............#...."
+    "............####..............#...."
+    ".............##...............#...."
+    "..............................#...."
+    "..............................#...."
+    "###############################...."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "..................................."
+    "...................................";
+
+  //===== Packed icons =====
+  static constexpr auto nextPageArrowBits = packIcon<35, 35>(nextPageArrowArt);
+  static constexpr auto previousPageArrowBits = packIcon<35, 35>(previousPageArrowArt);
+
+  const iconBitmap arrowIcons::nextPageArrow = {35, 35, nextPageArrowBits.data};
+  const iconBitmap arrowIcons::previousPageArrow = {35, 35, previousPageArrowBits.data};
+} // namespace evAPI
@@ -11,71 +11,216 @@
 #define UIDATA_H
 
 #include "anyData.h"
+#include "../evAPI/Common/include/evErrorTypes.h"
+
+//Max length of the label and data text. One line on the controller.
+#define UI_DATA_TEXT_LENGTH 19
 
 namespace evAPI
 {
+  /**
+   * @brief Text of a UIData object. The pointers point into the UIData object, and are valid until
+   *        its data is changed or the object is moved, such as when the vector holding it grows.
+  */
   struct UIDataReturn
   {
-    std::string label;
-    std::string data;
+    const char *label = "";
+    const char *data = "";
     bool hasChanged = false;
     evError errorData = evError::No_Error;
   };
 
+  /**
+   * @brief Pointer to the variable a UIData object displays. The member that is used is picked by the
+   *        type of the variable with dataSourceMember, so the pointer keeps its type.
+  */
+  union dataSource
+  {
+    const signed char *signedChar;
+    const short *signedShort;
+    const int *signedInt;
+    const long *signedLong;
+    const long long *signedLongLong;
+    const unsigned char *unsignedChar;
+    const unsigned short *unsignedShort;
+    const unsigned int *unsignedInt;
+    const unsigned long *unsignedLong;
+    const unsigned long long *unsignedLongLong;
+    const float *floatValue;
+    const double *doubleValue;
+    const bool *boolValue;
+    const char *charValue;
+    const std::string *stringValue;
+  };
+
+  /**
+   * @brief Gets and sets the member of dataSource used for a type. Only the types in dataSource have
+   *        one, so binding any other type doesn't compile.
+  */
+  template<typename T> struct dataSourceMember;
+
+  #define UI_DATA_SOURCE_MEMBER(type, member) \
+    template<> struct dataSourceMember<type> \
+    { \
+      static const type *get(const dataSource &source) { return source.member; } \
+      static void set(dataSource &source, const type *data) { source.member = data; } \
+    };
+
+  UI_DATA_SOURCE_MEMBER(signed char, signedChar)
+  UI_DATA_SOURCE_MEMBER(short, signedShort)
+  UI_DATA_SOURCE_MEMBER(int, signedInt)
+  UI_DATA_SOURCE_MEMBER(long, signedLong)
+  UI_DATA_SOURCE_MEMBER(long long, signedLongLong)
+  UI_DATA_SOURCE_MEMBER(unsigned char, unsignedChar)
+  UI_DATA_SOURCE_MEMBER(unsigned short, unsignedShort)
+  UI_DATA_SOURCE_MEMBER(unsigned int, unsignedInt)
+  UI_DATA_SOURCE_MEMBER(unsigned long, unsignedLong)
+  UI_DATA_SOURCE_MEMBER(unsigned long long, unsignedLongLong)
+  UI_DATA_SOURCE_MEMBER(float, floatValue)
+  UI_DATA_SOURCE_MEMBER(double, doubleValue)
+  UI_DATA_SOURCE_MEMBER(bool, boolValue)
+  UI_DATA_SOURCE_MEMBER(char, charValue)
+  UI_DATA_SOURCE_MEMBER(std::string, stringValue)
+
+  #undef UI_DATA_SOURCE_MEMBER
+
+  /**
+   * @brief A line of data for the UIs. The data is bound by a pointer to the variable and a function
+   *        that formats it, both stored inside the object, so no memory is allocated for each line.
+  */
   class UIData
   {
     private:
-      //Data the object stores
-      anyDataCore *data = nullptr;
+      //Function that writes the bound data into dataText. Returns true if the text changed.
+      typedef bool (*dataWriter)(UIData &line);
+
+      //The variable the object displays
+      dataSource source = {};
+
+      //Writes the variable into dataText. Set to the version of writeBoundData for the variable's type.
+      dataWriter writer = nullptr;
+
+      //How the data is written
+      formatSpec spec;
+
+      //Copy of the last value that was written. Used to skip formatting values that haven't changed.
+      uint64_t dataHistory = 0;
 
-      //Data from the previous time it was read out
-      std::string prevData;
+      //True once the data has been written at least once
+      bool written = false;
+
+      //True if the line has been set
+      bool used = false;
+
+      //Text of the data from the last time it was read out
+      char dataText[UI_DATA_TEXT_LENGTH+1] = "";
 
       //Name of the object
-      std::string label;
+      char label[UI_DATA_TEXT_LENGTH+1] = "";
+
+      /**
+       * @brief Stores the label and clears the data.
+       * @returns An evError. Invalid_Argument_Data if labelIn is invalid.
+       *          No_Error if there aren't any errors.
+      */
+      evError setLabel(const char *labelIn);
+
+      /**
+       * @brief Writes the bound data into dataText if it has changed.
+       * @tparam T The type of the bound data.
+       * @param line The UIData object to write.
+       * @returns True if the text changed.
+      */
+      template<typename T> static bool writeBoundData(UIData &line);
 
     public:
       UIData();
-      ~UIData();
 
       /**
        * @brief Sets the data and name stored in the object.
        * 
        * @tparam T The type of data being stored.
        * @param labelIn A name attached to the UIData object.
-       * @param dataIn An pointer to the data to store
+       * @param dataIn A pointer to the data to display. It must stay valid while the object uses it.
+       * @param specIn Optional. How the data is written.
        * @returns An evError. Invalid_Argument_Data if labelIn is invalid.
+       *          Object_Property_Not_Specified if dataIn is null.
        *          No_Error if there aren't any errors.
       */
-      template<typename T> evError setData(const char *labelIn, T *dataIn);
+      template<typename T> evError setData(const char *labelIn, const T *dataIn, formatSpec specIn = formatSpec());
+
+      /**
+       * @brief Sets the object to only display a name.
+       * @param labelIn The name to display.
+       * @returns An evError. Invalid_Argument_Data if labelIn is invalid.
+       *          No_Error if there aren't any errors.
+      */
+      evError setText(const char *labelIn);
+
+      /**
+       * @returns True if the object has been set with setData() or setText().
+      */
+      bool isUsed();
 
       /**
        * @returns A UIDataReturn structure. It contains the label, data, evError, and a 
-       *          hasChanged flag.
+       *          hasChanged flag. The data is only formatted again if its value changed, and
+       *          nothing is allocated.
       */
       UIDataReturn getData();
   };
 
-  template<typename T> evError UIData::setData(const char *labelIn, T *dataIn)
+  template<typename T> bool UIData::writeBoundData(UIData &line)
+  {
+    static_assert(!std::is_arithmetic<T>::value || sizeof(T) <= sizeof(line.dataHistory),
+                  "Type is too large to store in the data history");
+
+    const T &value = *dataSourceMember<T>::get(line.source);
+
+    //*Skip values that are the same as the last time
+    if(line.written && !dataHasChanged(value, &line.dataHistory))
+    {
+      return false;
+    }
+
+    //*Format the data and check if the text changed
+    char newText[UI_DATA_TEXT_LENGTH+1];
+    formatData(newText, sizeof(newText), value, line.spec);
+    storeDataHistory(value, &line.dataHistory);
+
+    bool changed = !line.written || strcmp(newText, line.dataText) != 0;
+
+    if(changed)
+    {
+      strcpy(line.dataText, newText);
+    }
+
+    line.written = true;
+
+    return changed;
+  }
+
+  template<typename T> evError UIData::setData(const char *labelIn, const T *dataIn, formatSpec specIn)
   {
     //Make sure the name is valid
-    if(labelIn == nullptr)
+    evError labelError = setLabel(labelIn);
+
+    if(labelError != evError::No_Error)
     {
-      return evError::Invalid_Argument_Data;
+      return labelError;
     }
 
-    //Store the name
-    label = labelIn;
+    //*Bind the data
+    dataSourceMember<T>::set(source, dataIn);
+    spec = specIn;
 
-    //Delete data if it already exists
-    if(data != nullptr)
+    if(dataIn == nullptr)
     {
-      delete data;
+      writer = nullptr;
+      return evError::Object_Property_Not_Specified;
     }
 
-    //Create and set the data object
-    data = new anyData<T>;
-    data->setData(dataIn);
+    writer = &UIData::writeBoundData<T>;
     
     return evError::No_Error;
   }
@@ -3,96 +3,125 @@
 /*    Module:       anyData.h                                                 */
 /*    Author:       Jayden Liffick                                            */
 /*    Created:      Dec 13, 2023                                              */
-/*    Description:  Template class that allows for storing any type of data   */
-/*                  that can be converted to a string                         */
+/*    Description:  Functions that allow for writing any type of data that    */
+/*                  can be converted to a string into a character buffer.     */
 /*                                                                            */
 /*----------------------------------------------------------------------------*/
 
 #ifndef ANYDATA_H
 #define ANYDATA_H
 
-#include "../evAPI/Common/include/evPatch.h"
-#include "../evAPI/Common/include/evErrorTypes.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
 
 namespace evAPI
 {
   /**
-   * @brief An accessor class used for storing all the data as a vector or array. Should be created with
-   *        a anyData object with the desired type.
-   * @example anyDataCore *data = anyData<int>;
+   * @brief How a value is written as text. Can be created at compile time.
+   * @example constexpr formatSpec speedFormat = formatSpec(1, 5, "in/s");
   */
-  class anyDataCore
+  struct formatSpec
   {
-    public:
-      virtual ~anyDataCore() = default;
-      virtual evError setData(void *newData) = 0;
-      virtual evErrorString getData() = 0;
+    //Digits after the decimal point for floating point values. -1 to use the shortest form.
+    int8_t precision;
+
+    //Minimum amount of characters the value takes up. The value is padded with spaces on the left.
+    uint8_t width;
+
+    //Text added after the value
+    const char *units;
+
+    constexpr formatSpec(int8_t precisionIN = -1, uint8_t widthIN = 0, const char *unitsIN = "") :
+      precision(precisionIN), width(widthIN), units(unitsIN)
+    {}
   };
 
+  //*Functions that write a value into a character buffer without allocating memory
+
   /**
-   * @brief A template class used to store a pointer to a variable, and return its values
-   *        as a string. Should be created with an anyDataCore 
-   * @tparam T The type of data that will be stored in the anyData object.
-   * @example anyDataCore *data = anyData<int>; 
+   * @brief Writes a value into a character buffer. The text is cut off if it doesn't fit.
+   * @param buffer The buffer to write into.
+   * @param size The size of the buffer, including the null character.
+   * @param value The value to write.
+   * @param spec How the value is written.
   */
-  template<typename T> class anyData: public anyDataCore
+  template<typename T> typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+  formatData(char *buffer, size_t size, const T &value, const formatSpec &spec)
   {
-    private:
-      T *data = nullptr;
-
-    public:
-      /**
-       * @brief Creates a new anyData object that points to the set data.
-       * @param data A pointer to the data to store.
-       * @returns An evError. Object_Property_Not_Specified if data is invalid.
-       *          No_Error if their aren't any errors.
-      */
-      evError setData(void *newData);
-
-      /**
-       * @returns An evErrorData object containing a std::string. If the data isn't null, the string will 
-       * containing the data from setData(). If it is, the error will be Object_Property_Not_Specified.
-      */
-      evErrorString getData();
-  };
-  
-  template<typename T> evError anyData<T>::setData(void *newData)
+    snprintf(buffer, size, "%*ld%s", spec.width, (long)value, spec.units);
+  }
+
+  template<typename T> typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+  formatData(char *buffer, size_t size, const T &value, const formatSpec &spec)
   {
-    //Only set the data if it isn't null
-    if(newData != nullptr)
+    snprintf(buffer, size, "%*lu%s", spec.width, (unsigned long)value, spec.units);
+  }
+
+  template<typename T> typename std::enable_if<std::is_floating_point<T>::value>::type
+  formatData(char *buffer, size_t size, const T &value, const formatSpec &spec)
+  {
+    if(spec.precision < 0)
     {
-      data = (T*)newData;
+      snprintf(buffer, size, "%*g%s", spec.width, (double)value, spec.units);
     }
-    
+
     else
     {
-      data = nullptr;
-      return evError::Object_Property_Not_Specified;
+      snprintf(buffer, size, "%*.*f%s", spec.width, spec.precision, (double)value, spec.units);
     }
+  }
 
-    return evError::No_Error;
+  inline void formatData(char *buffer, size_t size, const bool &value, const formatSpec &spec)
+  {
+    snprintf(buffer, size, "%*d%s", spec.width, value ? 1 : 0, spec.units);
   }
 
-  template<typename T> evErrorString anyData<T>::getData()
+  inline void formatData(char *buffer, size_t size, const char &value, const formatSpec &spec)
   {
-    evErrorString dataString;
+    snprintf(buffer, size, "%*c%s", spec.width, value, spec.units);
+  }
 
-    //Get data if data exists
-    if(data != nullptr)
-    {
-      dataString.data = evPatch::to_string(*data);
-    }
+  inline void formatData(char *buffer, size_t size, const std::string &value, const formatSpec &spec)
+  {
+    snprintf(buffer, size, "%*s%s", spec.width, value.c_str(), spec.units);
+  }
 
-    //Report an error if the data isn't found
-    else
-    {
-      dataString.data = std::string("");
-      dataString.errorData = evError::Object_Property_Not_Specified;
-    }
+  //*Change detection
 
-    return dataString;
+  /**
+   * @brief Values small enough to copy are compared against a copy of the last value before they
+   *        are formatted, so unchanged values are never formatted again.
+   * @param history Storage for the copy of the last value.
+   * @returns True if the value is different from the copy in history.
+  */
+  template<typename T> typename std::enable_if<std::is_arithmetic<T>::value, bool>::type
+  dataHasChanged(const T &value, uint64_t *history)
+  {
+    return memcmp(history, &value, sizeof(T)) != 0;
   }
-  
+
+  /**
+   * @brief Strings aren't copied, so they are always formatted and then compared to the old text.
+  */
+  template<typename T> typename std::enable_if<!std::is_arithmetic<T>::value, bool>::type
+  dataHasChanged(const T &value, uint64_t *history)
+  {
+    return true;
+  }
+
+  template<typename T> typename std::enable_if<std::is_arithmetic<T>::value>::type
+  storeDataHistory(const T &value, uint64_t *history)
+  {
+    memcpy(history, &value, sizeof(T));
+  }
+
+  template<typename T> typename std::enable_if<!std::is_arithmetic<T>::value>::type
+  storeDataHistory(const T &value, uint64_t *history)
+  {}
+
 } // namespace evAPI
 
-#endif // ANYDATA_H
\ No newline at end of file
+#endif // ANYDATA_H
@@ -11,16 +11,72 @@
 #define VEXUI_H
 
 #include "../evAPI/Common/include/evAPIBasicConfig.h"
+#include "../evAPI/Common/include/generalFunctions.h"
+#include "../evAPI/Common/include/TaskManager.h"
+#include "../evAPI/Common/include/LoopProfiler.h"
 #include "../../AutoSelector/include/AutoSelector.h"
 #include "../../controllerUI/include/controllerUI.h"
 
+//Max amount of timers the UI event loop can run
+#define UI_MAX_TIMERS 8
+
+//Timers that are due within this many msec of each other are run together
+#define UI_TIMER_SLACK 5
+
+//Longest time in msec the event loop sleeps, so it notices when the robot mode changes
+#define UI_IDLE_CHECK_TIME 100
+
+//Time between controller screen refreshes in msec in each robot mode. 0 stops the refreshes.
+#define UI_CONTROLLER_REFRESH_DISABLED 20
+#define UI_CONTROLLER_REFRESH_DRIVER 100
+#define UI_CONTROLLER_REFRESH_AUTONOMOUS 0
+
+//Time between checks for rumbles in msec during autonomous, while the controller screens aren't refreshed
+#define UI_CONTROLLER_RUMBLE_AUTONOMOUS 50
+
 namespace evAPI
 {
   class vexUI
   {
     private:
-      //*Threads used for updating the UIs
-      vex::thread *controllerUIThread = nullptr;
+      struct uiTimer
+      {
+        //Function the timer runs
+        void (*callback)(void *);
+        void *context;
+
+        //Time between runs in msec for each robotMode. 0 if the timer doesn't run in that mode.
+        uint periods[3];
+
+        //System time the timer is due in msec
+        uint32_t nextTime;
+      };
+
+      //*Thread used for updating the UIs
+      vex::thread *uiThread = nullptr;
+
+      //ID of the UI thread in the task manager
+      int uiTaskID = -1;
+
+      //Timing of the timers run by the UI thread
+      LoopProfiler uiProfiler = LoopProfiler("UI Timers", 0);
+
+      //Periodic work run by the UI thread
+      uiTimer timers[UI_MAX_TIMERS];
+      uint timerCount = 0;
+
+      /**
+       * @returns The robotMode the UI should use. The UI always runs at full speed when the robot
+       *          isn't connected to a field or competition switch, so it can be used during practice.
+      */
+      robotMode getUIMode();
+
+      /**
+       * @brief The UI event loop. Sleeps until the next timer is due, then runs every timer that is due.
+       * @param UIClass A pointer to a vexUI object.
+       * @returns 0
+      */
+      friend int uiEventLoop(void *UIClass);
 
     public:
       vexUI();
@@ -34,16 +90,31 @@ namespace evAPI
       */
       evError startThreads();
 
+      /**
+       * @brief Adds a function that the UI thread runs periodically. The period changes with the
+       *        robot mode, so UI work can be slowed down or stopped during a match.
+       * @param callback The function to run. The context pointer is passed into it.
+       * @param context A pointer passed into the callback.
+       * @param disabledTime The time between runs in msec while disabled or not connected to a field.
+       * @param driverTime The time between runs in msec during driver control. 0 to not run.
+       * @param autonomousTime The time between runs in msec during autonomous. 0 to not run.
+       * @returns An evError.
+       *          Invalid_Argument_Data: If the callback is null.
+       *          Range_Limit_Reached: If there is no room for more timers.
+       *          No_Error: If the timer was added.
+      */
+      evError addTimer(void (*callback)(void *), void *context, uint disabledTime, uint driverTime, uint autonomousTime);
+
       //*UI objects
       /**
        * @brief The UI for the primary controller. Displays three lines of data at a time, but can scroll to display different lines.
       */
-      controllerUI primaryControllerUI = controllerUI(primaryController.Screen);
+      controllerUI primaryControllerUI = controllerUI(primaryController);
 
       /**
        * @brief The UI for the secondary controller. Displays three lines of data at a time, but can scroll to display different lines.
       */
-      controllerUI secondaryControllerUI = controllerUI(secondaryController.Screen);
+      controllerUI secondaryControllerUI = controllerUI(secondaryController);
 
       /**
        * @brief The UI for the auto selector. Consists of pages that each contain 8 customizable buttons. Pages can be switched
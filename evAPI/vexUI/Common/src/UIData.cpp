@@ -13,13 +13,36 @@ namespace evAPI
 {
   UIData::UIData()
   {}
-  
-  UIData::~UIData()
+
+  evError UIData::setLabel(const char *labelIn)
   {
-    if(data != nullptr)
+    //Make sure the name is valid
+    if(labelIn == nullptr)
     {
-      delete data;
+      return evError::Invalid_Argument_Data;
     }
+
+    //Store the name
+    snprintf(label, sizeof(label), "%s", labelIn);
+
+    //Clear any old data
+    source = dataSource();
+    writer = nullptr;
+    written = false;
+    dataText[0] = '\0';
+    used = true;
+
+    return evError::No_Error;
+  }
+
+  evError UIData::setText(const char *labelIn)
+  {
+    return setLabel(labelIn);
+  }
+
+  bool UIData::isUsed()
+  {
+    return used;
   }
 
   UIDataReturn UIData::getData()
@@ -27,24 +50,19 @@ namespace evAPI
     //Get data to return
     UIDataReturn dataOut;
 
-    //Data stored by the user
-    evErrorData<std::string> objectData;
-
-    //*Get needed data and return it
-    objectData = data->getData();
-
     //Store the needed data being outputted
     dataOut.label = label;
-    dataOut.errorData = objectData.errorData;
-    dataOut.data = objectData.data;
-    
-    //Check if data has changed
-    if(objectData.data != prevData)
+    dataOut.data = dataText;
+
+    //Exit if there is no data to write
+    if(writer == nullptr)
     {
-      dataOut.hasChanged = true;
+      dataOut.errorData = evError::Object_Property_Not_Specified;
+      return dataOut;
     }
 
-    prevData = objectData.data;
+    //*Write the data into the text buffer. This also checks if the data has changed.
+    dataOut.hasChanged = writer(*this);
 
     //*Return the data
     return dataOut;
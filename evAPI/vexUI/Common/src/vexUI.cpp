@@ -2,62 +2,61 @@
 
 namespace evAPI
 {
-  int controllerThread(void *UIClass)
+  int uiEventLoop(void *UIClass)
   {
     //Get the thread input and store it as a copy of the UI
     vexUI *UI = (vexUI*)UIClass;
 
-    //Stores if the controllers were previously installed
-    bool prevPrimaryControllerInstalled = false;
-    bool prevSecondaryControllerInstalled = false;
-
-    bool primaryControllerInstalled = false;
-    bool secondaryControllerInstalled = false;
-    
     //*Main thread loop
     while(true)
     {
-      //Get current conenction status of controllers
-      primaryControllerInstalled = primaryController.installed();
-      secondaryControllerInstalled = secondaryController.installed();
+      robotMode mode = UI->getUIMode();
+      uint32_t currentTime = vex::timer::system();
+
+      //Wake up at least this often to check the robot mode
+      uint32_t wakeTime = currentTime + UI_IDLE_CHECK_TIME;
 
-      //*Primary Controller
-      if(primaryControllerInstalled)
+      //*Run every timer that is due, or almost due
+      for(uint i = 0; i < UI->timerCount; i++)
       {
-        //Update the screen data if the controller is still connected
-        if(prevPrimaryControllerInstalled)
-        {
-          UI->primaryControllerUI.updateScreenData();
-        }
+        vexUI::uiTimer &timer = UI->timers[i];
+        uint period = timer.periods[mode];
 
-        //Update the entire screen if the controller just reconnected
-        else
+        //Skip timers that don't run in this mode
+        if(period == 0)
         {
-          UI->primaryControllerUI.updateScreen();
+          continue;
         }
-      }
 
-      //*Secondary Controller
-      if(secondaryControllerInstalled)
-      {
-        //Update the screen data if the controller is still connected
-        if(prevSecondaryControllerInstalled)
+        if((int32_t)(currentTime + UI_TIMER_SLACK - timer.nextTime) >= 0)
         {
-          UI->secondaryControllerUI.updateScreenData();
+          taskManager.beginWork(UI->uiTaskID);
+          UI->uiProfiler.beginLoop();
+          timer.callback(timer.context);
+          UI->uiProfiler.endLoop();
+          taskManager.endWork(UI->uiTaskID);
+          timer.nextTime = currentTime + period;
         }
 
-        //Update the entire screen if the controller just reconnected
-        else
+        //Find the next time a timer is due
+        if((int32_t)(timer.nextTime - wakeTime) < 0)
         {
-          UI->secondaryControllerUI.updateScreen();
+          wakeTime = timer.nextTime;
         }
       }
 
-      //Store current connection status of controllers
-      prevPrimaryControllerInstalled = primaryControllerInstalled;
-      prevSecondaryControllerInstalled = secondaryControllerInstalled;
+      //*Sleep until the next timer is due
+      int32_t sleepTime = (int32_t)(wakeTime - vex::timer::system());
+
+      if(sleepTime > 0)
+      {
+        vex::this_thread::sleep_for(sleepTime);
+      }
 
-      vex::this_thread::sleep_for(10);
+      else
+      {
+        vex::this_thread::yield();
+      }
     }
 
     return 0;
@@ -68,22 +67,70 @@ namespace evAPI
   
   vexUI::~vexUI()
   {
-    delete controllerUIThread;
+    delete uiThread;
   }
 
   evError vexUI::startThreads()
   {
-    //Exit if the controller thread already exists
-    if(controllerUIThread != nullptr)
+    //Exit if the UI thread already exists
+    if(uiThread != nullptr)
     {
       return evError::Data_Already_Exists;
     }
 
-    controllerUIThread = new vex::thread(controllerThread, this);
+    //*Refresh both controllers from the UI thread
+    addTimer(refreshControllerUI, &primaryControllerUI, UI_CONTROLLER_REFRESH_DISABLED,
+             UI_CONTROLLER_REFRESH_DRIVER, UI_CONTROLLER_REFRESH_AUTONOMOUS);
+    addTimer(refreshControllerUI, &secondaryControllerUI, UI_CONTROLLER_REFRESH_DISABLED,
+             UI_CONTROLLER_REFRESH_DRIVER, UI_CONTROLLER_REFRESH_AUTONOMOUS);
+
+    //*Rumbles are still sent during autonomous
+    addTimer(rumbleControllerUI, &primaryControllerUI, 0, 0, UI_CONTROLLER_RUMBLE_AUTONOMOUS);
+    addTimer(rumbleControllerUI, &secondaryControllerUI, 0, 0, UI_CONTROLLER_RUMBLE_AUTONOMOUS);
 
+    uiThread = new vex::thread(uiEventLoop, this);
+    uiTaskID = taskManager.addTask(uiThread, taskRole::UI, "UI");
+
+    //The auto selector runs from screen press events
     autoSelectorUI.startThread();
 
     return evError::No_Error;
   }
 
+  evError vexUI::addTimer(void (*callback)(void *), void *context, uint disabledTime, uint driverTime, uint autonomousTime)
+  {
+    if(callback == nullptr)
+    {
+      return evError::Invalid_Argument_Data;
+    }
+
+    if(timerCount >= UI_MAX_TIMERS)
+    {
+      return evError::Range_Limit_Reached;
+    }
+
+    uiTimer &timer = timers[timerCount];
+    timer.callback = callback;
+    timer.context = context;
+    timer.periods[robotMode::disabled] = disabledTime;
+    timer.periods[robotMode::driverControl] = driverTime;
+    timer.periods[robotMode::autonomousControl] = autonomousTime;
+    timer.nextTime = vex::timer::system();
+
+    timerCount++;
+
+    return evError::No_Error;
+  }
+
+  robotMode vexUI::getUIMode()
+  {
+    //Run at full speed during practice
+    if(!isConnectToField())
+    {
+      return robotMode::disabled;
+    }
+
+    return getCompetitionStatus();
+  }
+
 } // namespace evAPI
\ No newline at end of file
@@ -0,0 +1,182 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       PIDTuner.h                                                */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Controller page for changing the drive PID constants      */
+/*                  while the robot is running.                               */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef PIDTUNER_H
+#define PIDTUNER_H
+
+#include <string>
+#include "../../../Common/include/generalFunctions.h"
+#include "../../../Common/include/ConfigStore.h"
+#include "../../../Common/include/TaskManager.h"
+#include "../../../Common/include/ButtonManager.h"
+#include "../../../robotControl/Drivetrain/include/Drive.h"
+#include "../../../robotControl/DriverBaseControl/include/DriverBaseControl.h"
+#include "../../controllerUI/include/controllerUI.h"
+
+//Amount of PIDs that can be tuned. These are the first PIDs in pidType. The vision PIDs after them
+//are left out, since their test motion needs an object in front of the vision sensor.
+#define PID_TUNER_PID_COUNT 5
+
+//Time of one cycle of the drive functions in ms
+#define PID_TUNER_CYCLE_TIME 20
+
+namespace evAPI
+{
+  /**
+   * @brief A page on a controller UI that lets the driver change the gains of the drive PIDs and run
+   *        a test motion with them. The vision PIDs can't be selected.
+   *
+   *        Controls while the page is shown:
+   *        Up / Down:    Select the PID, kP, kI, or kD.
+   *        Left / Right: Change the selected item.
+   *        Y:            Change the step size.
+   *        A:            Run a test motion with the selected PID.
+   *        B:            Save the gains to the config store.
+   *
+   *        The page uses three lines on the controller UI. Lines are only sent to the controller
+   *        when their text changes.
+  */
+  class PIDTuner
+  {
+    private:
+      //Drive base being tuned
+      Drive *drivetrain = nullptr;
+
+      //Config the gains are saved to
+      ConfigStore *config = nullptr;
+
+      //Driver control that is paused while a test runs
+      DriverBaseControl *driverControl = nullptr;
+
+      //Controller UI the page is on
+      controllerUI *screen = nullptr;
+
+      //ID of the first of the three lines on the controller UI
+      uint pageLine = 0;
+
+      //Controller that is used to change the values
+      vex::controllerType controllerSelection = vex::controllerType::primary;
+
+      //*Selections
+      //The PID being tuned
+      pidType selectedPID = pidType::Drive;
+
+      //0 for the PID, 1-3 for kP, kI, and kD
+      uint selectedItem = 0;
+
+      //Index of the step size in stepSizes
+      uint selectedStep = 2;
+
+      //*Test motion settings
+      double testDistance = 24;
+      double testAngle = 90;
+      double testRadius = 24;
+
+      //Direction of the next test. Flips every test so the robot goes back to where it started.
+      bool testReversed = false;
+
+      //True while a test motion is running
+      volatile bool testRunning = false;
+
+      //True if a test has been run with the current PID
+      bool hasTestResults = false;
+
+      //Results of the last test
+      double settleTime = 0;
+      double overshoot = 0;
+
+      //Test state that is currently shown on the page
+      bool shownTestRunning = false;
+
+      //*Text for each line of the page
+      std::string pidLine;
+      std::string gainLine;
+      std::string resultLine;
+
+      /**
+       * @brief Changes the selected item by one step.
+       * @param direction 1 to increase the item, -1 to decrease it.
+      */
+      void changeSelection(int direction);
+
+      /**
+       * @brief Rebuilds the text of each line from the current selections.
+      */
+      void updateText();
+
+      /**
+       * @brief Runs the test motion for the selected PID. Called by the test thread.
+      */
+      void runTest();
+
+      /**
+       * @brief Function the test motion thread runs.
+       * @param tunerObject A pointer to a PIDTuner object.
+      */
+      friend void pidTunerTestThread(void *tunerObject);
+
+    public:
+      /**
+       * @brief Creates a PID tuner.
+       * @param drivetrainIN The drive base to tune.
+      */
+      PIDTuner(Drive &drivetrainIN);
+
+      /**
+       * @brief Adds the page to a controller UI.
+       * @param UI The controller UI to add the page to.
+       * @param firstLine The ID of the first line of the page. The page also uses the next two IDs.
+       * @param controller Optional. The controller that is used to change the values.
+       * @returns An evError.
+       *          Data_Already_Exists: If one of the lines already exists.
+       *          No_Error: If the page was added.
+      */
+      evError attach(controllerUI &UI, uint firstLine, vex::controllerType controller = vex::controllerType::primary);
+
+      /**
+       * @brief Sets the config store the gains are saved to when B is pressed.
+       * @param configIN The config store.
+      */
+      void setConfig(ConfigStore &configIN);
+
+      /**
+       * @brief Sets the driver control that is paused while a test motion runs, so only the test
+       *        drives the base.
+       * @param driverControlIN The driver control of the drive base.
+      */
+      void setDriverControl(DriverBaseControl &driverControlIN);
+
+      /**
+       * @brief Sets the size of the test motions.
+       * @param distance The distance in inches used to test the drive and drift PIDs.
+       * @param angle The angle in degrees used to test the turn and arc PIDs.
+       * @param radius The radius in inches used to test the arc PIDs.
+      */
+      void setTestMotion(double distance, double angle, double radius);
+
+      /**
+       * @returns True if the page is the one shown on the controller UI.
+      */
+      bool isActive();
+
+      /**
+       * @returns True while a test motion is running. Driver control of the base is paused while this
+       *          is true if it was given with setDriverControl().
+      */
+      bool isTestRunning();
+
+      /**
+       * @brief Reads the controller buttons and updates the page. Does nothing if the page isn't
+       *        shown. Call this in a loop.
+      */
+      void update();
+  };
+} // namespace evAPI
+
+#endif // PIDTUNER_H
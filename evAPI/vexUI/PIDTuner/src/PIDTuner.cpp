@@ -0,0 +1,340 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       PIDTuner.cpp                                              */
+/*    Created:      Oct 18, 2026                                              */
+/*    Description:  Controller page for changing the drive PID constants      */
+/*                  while the robot is running.                               */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "../include/PIDTuner.h"
+
+namespace evAPI
+{
+  //Names of the PIDs. These match the names used in the config file.
+  static const char *pidNames[PID_TUNER_PID_COUNT] = {
+    "drivePID",
+    "turnPID",
+    "driftPID",
+    "arcPID",
+    "arcDriftPID"
+  };
+
+  //Amounts the gains can be changed by
+  static const double stepSizes[] = {0.0001, 0.001, 0.01, 0.1, 1};
+  static const uint stepSizeCount = sizeof(stepSizes) / sizeof(stepSizes[0]);
+
+  void pidTunerTestThread(void *tunerObject)
+  {
+    PIDTuner *tuner = (PIDTuner*)tunerObject;
+
+    //The test drives the robot, so it runs at the priority of a motion
+    int taskID = taskManager.addCurrentTask(taskRole::Motion, "PID Test");
+    taskManager.beginWork(taskID);
+    tuner->runTest();
+    taskManager.endWork(taskID);
+    taskManager.removeTask(taskID);
+  }
+
+  PIDTuner::PIDTuner(Drive &drivetrainIN)
+  {
+    drivetrain = &drivetrainIN;
+    updateText();
+  }
+
+  evError PIDTuner::attach(controllerUI &UI, uint firstLine, vex::controllerType controller)
+  {
+    screen = &UI;
+    pageLine = firstLine;
+    controllerSelection = controller;
+
+    //*Add the three lines of the page
+    evError lineError = UI.addData(firstLine, "", pidLine);
+
+    if(lineError != evError::No_Error)
+    {
+      return lineError;
+    }
+
+    lineError = UI.addData(firstLine + 1, "", gainLine);
+
+    if(lineError != evError::No_Error)
+    {
+      return lineError;
+    }
+
+    return UI.addData(firstLine + 2, "", resultLine);
+  }
+
+  void PIDTuner::setConfig(ConfigStore &configIN)
+  {
+    config = &configIN;
+  }
+
+  void PIDTuner::setDriverControl(DriverBaseControl &driverControlIN)
+  {
+    driverControl = &driverControlIN;
+  }
+
+  void PIDTuner::setTestMotion(double distance, double angle, double radius)
+  {
+    testDistance = distance;
+    testAngle = angle;
+    testRadius = radius;
+  }
+
+  bool PIDTuner::isActive()
+  {
+    if(screen == nullptr)
+    {
+      return false;
+    }
+
+    return screen->getLineNumber().data == pageLine;
+  }
+
+  bool PIDTuner::isTestRunning()
+  {
+    return testRunning;
+  }
+
+  void PIDTuner::changeSelection(int direction)
+  {
+    //*Change the selected PID
+    if(selectedItem == 0)
+    {
+      int newPID = ((int)selectedPID + direction + PID_TUNER_PID_COUNT) % PID_TUNER_PID_COUNT;
+      selectedPID = (pidType)newPID;
+      hasTestResults = false;
+      return;
+    }
+
+    //*Change the selected gain
+    PID &targetPID = drivetrain->getPID(selectedPID);
+    double gains[3] = {targetPID.getKP(), targetPID.getKI(), targetPID.getKD()};
+
+    gains[selectedItem - 1] += direction * stepSizes[selectedStep];
+
+    //Gains can't be negative
+    if(gains[selectedItem - 1] < 0)
+    {
+      gains[selectedItem - 1] = 0;
+    }
+
+    targetPID.setConstants(gains[0], gains[1], gains[2]);
+  }
+
+  void PIDTuner::updateText()
+  {
+    char lineText[32];
+    PID &targetPID = drivetrain->getPID(selectedPID);
+    double gains[3] = {targetPID.getKP(), targetPID.getKI(), targetPID.getKD()};
+    static const char *gainNames[3] = {"kP", "kI", "kD"};
+
+    //*Selected PID and step size
+    if(selectedItem == 0)
+    {
+      snprintf(lineText, sizeof(lineText), "<%s> x%g", pidNames[(int)selectedPID], stepSizes[selectedStep]);
+    }
+
+    else
+    {
+      snprintf(lineText, sizeof(lineText), "%s x%g", pidNames[(int)selectedPID], stepSizes[selectedStep]);
+    }
+
+    //The lines are read by the UI thread, so they are changed while it is locked out
+    if(screen != nullptr)
+    {
+      screen->lockData();
+    }
+
+    pidLine = lineText;
+
+    //*Gains. Show all of them if the PID is selected, otherwise show the selected gain in detail.
+    if(selectedItem == 0)
+    {
+      snprintf(lineText, sizeof(lineText), "P%.3g I%.3g D%.3g", gains[0], gains[1], gains[2]);
+    }
+
+    else
+    {
+      snprintf(lineText, sizeof(lineText), "<%s %.4f>", gainNames[selectedItem - 1], gains[selectedItem - 1]);
+    }
+
+    gainLine = lineText;
+
+    //*Results of the last test
+    if(testRunning)
+    {
+      snprintf(lineText, sizeof(lineText), "Testing...");
+    }
+
+    else if(hasTestResults)
+    {
+      snprintf(lineText, sizeof(lineText), "%dms os %.3g", (int)settleTime, overshoot);
+    }
+
+    else
+    {
+      snprintf(lineText, sizeof(lineText), "A: Run test");
+    }
+
+    resultLine = lineText;
+
+    if(screen != nullptr)
+    {
+      screen->unlockData();
+    }
+
+    shownTestRunning = testRunning;
+  }
+
+  void PIDTuner::runTest()
+  {
+    vex::turnType direction = testReversed ? vex::turnType::left : vex::turnType::right;
+
+    //*Run the motion that uses the selected PID
+    switch(selectedPID)
+    {
+      case pidType::Drive:
+      case pidType::Drift:
+        if(testReversed)
+        {
+          drivetrain->driveBackward(testDistance);
+        }
+
+        else
+        {
+          drivetrain->driveForward(testDistance);
+        }
+        break;
+
+      case pidType::Turn:
+        drivetrain->turnFor(testAngle, direction);
+        break;
+
+      case pidType::Arc:
+      case pidType::ArcDrift:
+        drivetrain->arcTurn(testRadius, direction, testAngle);
+        break;
+
+      default:  //The vision PIDs aren't in the list, so they can't be selected
+        break;
+    }
+
+    //*Store the results
+    PID &targetPID = drivetrain->getPID(selectedPID);
+    settleTime = targetPID.getSettleCycles() * PID_TUNER_CYCLE_TIME;
+    overshoot = targetPID.getOvershoot();
+    hasTestResults = true;
+
+    testReversed = !testReversed;
+
+    if(driverControl != nullptr)
+    {
+      driverControl->setPaused(false);
+    }
+
+    testRunning = false;
+  }
+
+  void PIDTuner::update()
+  {
+    //Only use the controller while the page is shown
+    if(!isActive())
+    {
+      return;
+    }
+
+    //Show the results once a test finishes
+    if(testRunning != shownTestRunning)
+    {
+      updateText();
+    }
+
+    //Don't change anything while a test is running
+    if(testRunning)
+    {
+      return;
+    }
+
+    bool changed = false;
+
+    //*Select the item to change
+    if(buttonManager.wasPressed(controllerSelection, controllerButtons::UP))
+    {
+      selectedItem = (selectedItem + 3) % 4;
+      changed = true;
+    }
+
+    if(buttonManager.wasPressed(controllerSelection, controllerButtons::DOWN))
+    {
+      selectedItem = (selectedItem + 1) % 4;
+      changed = true;
+    }
+
+    //*Change the selected item
+    if(buttonManager.wasPressed(controllerSelection, controllerButtons::LEFT))
+    {
+      changeSelection(-1);
+      changed = true;
+    }
+
+    if(buttonManager.wasPressed(controllerSelection, controllerButtons::RIGHT))
+    {
+      changeSelection(1);
+      changed = true;
+    }
+
+    //*Change the step size
+    if(buttonManager.wasPressed(controllerSelection, controllerButtons::Y))
+    {
+      selectedStep = (selectedStep + 1) % stepSizeCount;
+      changed = true;
+    }
+
+    //*Save the gains
+    if(buttonManager.wasPressed(controllerSelection, controllerButtons::B) && config != nullptr)
+    {
+      PID &targetPID = drivetrain->getPID(selectedPID);
+      char key[CONFIG_KEY_LENGTH+1];
+      const char *name = pidNames[(int)selectedPID];
+
+      snprintf(key, sizeof(key), "%s.kp", name);
+      config->setNumber(key, targetPID.getKP());
+      snprintf(key, sizeof(key), "%s.ki", name);
+      config->setNumber(key, targetPID.getKI());
+      snprintf(key, sizeof(key), "%s.kd", name);
+      config->setNumber(key, targetPID.getKD());
+
+      if(config->save() == evError::No_Error)
+      {
+        screen->rumble(".");
+      }
+
+      else
+      {
+        screen->rumble("-");
+      }
+    }
+
+    //*Start a test
+    if(buttonManager.wasPressed(controllerSelection, controllerButtons::A))
+    {
+      //Pause driver control before the test starts so only the test drives the base
+      if(driverControl != nullptr)
+      {
+        driverControl->setPaused(true);
+      }
+
+      testRunning = true;
+      changed = true;
+      vex::thread(pidTunerTestThread, this).detach();
+    }
+
+    if(changed)
+    {
+      updateText();
+    }
+  }
+} // namespace evAPI
@@ -18,6 +18,16 @@
 #include "../evAPI/Common/include/evErrorTypes.h"
 #include "../../Common/include/UIData.h"
 
+//Amount of rows and columns on the controller screen
+#define CONTROLLER_UI_ROWS 3
+#define CONTROLLER_UI_COLUMNS 19
+
+//Minimum time between writes to the controller in msec
+#define CONTROLLER_UI_WRITE_TIME 50
+
+//Max length of a rumble pattern
+#define CONTROLLER_UI_RUMBLE_LENGTH 8
+
 namespace evAPI
 {
   /**
@@ -27,11 +37,15 @@ namespace evAPI
   class controllerUI
   {
     private:
+      //The controller the UI is on
+      vex::controller *parentDevice = nullptr;
+
       //The controller screen the UI controls
       vex::controller::lcd *parentController = nullptr;
 
-      //Each line on the controller
-      std::vector<UIData *> displayLines;
+      //Each line on the controller. The UIData objects move when the vector grows, so it is only
+      //resized while dataLock is held.
+      std::vector<UIData> displayLines;
 
       //The ID of the line at the top of the screen
       uint currentLine = 0;
@@ -39,8 +53,59 @@ namespace evAPI
       //True is the screen is being updated
       bool updatingScreen = false;
 
-            /**
-       * @brief Updates all the data points on the controller screen if their values have changed.
+      //Text that is currently shown on the controller screen. A null character means the character is unknown.
+      char shownText[CONTROLLER_UI_ROWS][CONTROLLER_UI_COLUMNS+1] = {};
+
+      //Text that should be shown on the controller screen
+      char targetText[CONTROLLER_UI_ROWS][CONTROLLER_UI_COLUMNS+1] = {};
+
+      //System time of the last write to the controller in msec
+      uint32_t lastWriteTime = 0;
+
+      //Row that is checked first for changes on the next write
+      uint8_t nextRow = 0;
+
+      //ID of the line that is written before any others. -1 if there isn't one.
+      int criticalLine = -1;
+
+      //Rumble pattern waiting to be sent to the controller
+      char pendingRumble[CONTROLLER_UI_RUMBLE_LENGTH+1] = "";
+
+      //Protects pendingRumble, since rumbles are queued from other threads than the UI thread
+      vex::mutex rumbleLock;
+
+      //Protects the bound data while the UI thread reads it
+      vex::mutex dataLock;
+
+      /**
+       * @brief Fills targetText with the lines that are currently on the screen.
+      */
+      void renderLines();
+
+      /**
+       * @brief Writes the changed part of a row to the controller, if the row has changed.
+       * @param row The row on the screen, starting at 0.
+       * @returns True if anything was sent to the controller.
+      */
+      bool writeRow(uint8_t row);
+
+      /**
+       * @brief Sends the pending rumble to the controller, if there is one.
+       * @returns True if a rumble was sent.
+      */
+      bool sendRumble();
+
+      /**
+       * @brief Sends the most important change to the controller. Pending rumbles go first, then the
+       *        critical line, then the other rows in turn.
+       * @returns True if anything was sent to the controller.
+      */
+      bool writeNextChange();
+
+      /**
+       * @brief Updates the changed data on the controller screen. The controller only accepts one
+       *        write every 50 msec, so at most one write is sent per call. Each write covers every
+       *        changed character on one row.
        * @param exitIfUpdating Optional. Set to true if the function should just exit if the screen is
        *                       being updated.
        * @returns An evError.
@@ -51,7 +116,7 @@ namespace evAPI
       evError updateScreenData(bool exitIfUpdating = false);
 
       /**
-       * @brief Redraws the entire controller screen.
+       * @brief Redraws the entire controller screen. The rows are sent over the next few writes.
        * @param exitIfUpdating Optional. Set to true if the function should just exit if the screen is
        *                       being updated.
        * @returns An evError.
@@ -61,15 +126,25 @@ namespace evAPI
       */
       evError updateScreen(bool exitIfUpdating = false);
 
+      //True if the controller was connected the last time the UI was refreshed
+      bool controllerWasInstalled = false;
+
+      /**
+       * @brief Refreshes the controller UI. Redraws the entire screen if the controller just connected.
+       *        Run by the vexUI event loop.
+       * @param controllerUIObject A pointer to a controllerUI object.
+      */
+      friend void refreshControllerUI(void *controllerUIObject);
+
       /**
-       * @brief A function that acts as a thread for both controller UIs.
-       * @param UIClass A pointer to a vexUI object.
-       * @returns 0
+       * @brief Sends a pending rumble without updating the screen. Run by the vexUI event loop when the
+       *        screen refresh is paused.
+       * @param controllerUIObject A pointer to a controllerUI object.
       */
-      friend int controllerThread(void *UIClass);
+      friend void rumbleControllerUI(void *controllerUIObject);
 
     public:
-      controllerUI(vex::controller::lcd &controller);
+      controllerUI(vex::controller &controller);
       ~controllerUI();
 
       /**
@@ -108,19 +183,61 @@ namespace evAPI
       */
       evErrorUInt getLineNumber();
 
+      /**
+       * @brief Sets a line that is written to the controller before the other lines when it changes.
+       * @param id The ID of the line. Set to -1 to remove the critical line.
+       * @returns An evError.
+       *          Index_Out_Of_Range: If id isn't a line on the UI.
+       *          No_Error: If the critical line was set.
+      */
+      evError setCriticalLine(int id);
+
+      /**
+       * @brief Rumbles the controller. The rumble is sent with the screen writes so it doesn't
+       *        get dropped when the screen is busy.
+       * @param pattern The rumble pattern. Uses '.' for a short rumble, '-' for a long rumble, and ' '
+       *        for a pause. Can be a max of 8 characters.
+       * @returns An evError.
+       *          Invalid_Argument_Data: If the pattern is invalid.
+       *          No_Error: If the rumble was queued.
+      */
+      evError rumble(const char *pattern);
+
+      /**
+       * @brief Stops the UI thread from reading the bound data. Data that can't be changed in one step,
+       *        like a std::string, should only be changed between lockData() and unlockData().
+      */
+      void lockData();
+
+      /**
+       * @brief Lets the UI thread read the bound data again.
+      */
+      void unlockData();
+
       /**
        * @brief Adds a new line to display data on the controller.
        * @param id The ID of the line.
        * @param name The name of the line. Can be a max of 19 characters.
-       * @param displayData The data to be displayed on the screen. Can be any type that can be converted
-       *        to a character array natively.
+       * @param displayData The data to be displayed on the screen. Can be an integer, floating point
+       *        number, bool, char, or std::string.
+       * @param spec Optional. How the data is written, such as the amount of decimal places and units.
+       *        The variable is bound by its address, so it must outlive the UI. Lines can be added while
+       *        the UI threads run, since the UI thread is locked out while the lines are moved.
        * @returns An evError.
        *          Data_Already_Exists: If a line already exists with that ID.
        *          Invalid_Argument_Data: If the name is invalid.
        *          No_Error: If the line was added successfully.
       */
-      template<typename T> evError addData(uint id, const char name[20], T &displayData)
+      template<typename T> evError addData(uint id, const char name[20], T &displayData, formatSpec spec = formatSpec())
       {
+        //Return if the name data is invalid.
+        if(name == nullptr)
+        {
+          return evError::Invalid_Argument_Data;
+        }
+
+        dataLock.lock();
+
         //Make sure the vector has size for the new data point.
         if(displayLines.size() < id+1)
         {
@@ -128,22 +245,16 @@ namespace evAPI
         }
 
         //Exit if a line already exists with that ID.
-        if(displayLines[id] != nullptr)
+        if(displayLines[id].isUsed())
         {
+          dataLock.unlock();
           return evError::Data_Already_Exists;
         }
 
-        //Return if the name data is invalid.
-        if(name == nullptr)
-        {
-          return evError::Invalid_Argument_Data;
-        }
-
-        //Create the new data point.
-        displayLines[id] = new UIData;
-
         //Set the parameters for the data point.
-        displayLines[id]->setData<T>(name, &displayData);
+        displayLines[id].setData<T>(name, &displayData, spec);
+
+        dataLock.unlock();
 
         return evError::No_Error;
       }
@@ -160,6 +271,18 @@ namespace evAPI
       */
       evError addData(uint id, const char name[20]);
   };
+
+  /**
+   * @brief Refreshes a controller UI. Used as a vexUI timer.
+   * @param controllerUIObject A pointer to a controllerUI object.
+  */
+  void refreshControllerUI(void *controllerUIObject);
+
+  /**
+   * @brief Sends a pending rumble on a controller. Used as a vexUI timer.
+   * @param controllerUIObject A pointer to a controllerUI object.
+  */
+  void rumbleControllerUI(void *controllerUIObject);
   
 } // namespace evAPI
 
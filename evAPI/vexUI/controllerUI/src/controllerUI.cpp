@@ -12,94 +12,196 @@
 
 namespace evAPI
 {
-  controllerUI::controllerUI(vex::controller::lcd &controller)
+  controllerUI::controllerUI(vex::controller &controller)
   {
-    parentController = &controller;
+    parentDevice = &controller;
+    parentController = &controller.Screen;
   }
   
   controllerUI::~controllerUI()
   {}
 
-  evError controllerUI::updateScreenData(bool exitIfUpdating)
+  void refreshControllerUI(void *controllerUIObject)
   {
-    //Return if there is no data to display
-    if(displayLines.size() == 0 || displayLines.max_size() == 0)
+    controllerUI *UI = (controllerUI*)controllerUIObject;
+
+    //Get current connection status of the controller
+    bool controllerInstalled = UI->parentDevice->installed();
+
+    if(controllerInstalled)
     {
-      return evError::No_Data_Defined;
+      //Update the screen data if the controller is still connected
+      if(UI->controllerWasInstalled)
+      {
+        UI->updateScreenData();
+      }
+
+      //Update the entire screen if the controller just reconnected
+      else
+      {
+        UI->updateScreen();
+      }
     }
 
-    //Decide what to do if the screen is being updated
-    if(updatingScreen)
+    UI->controllerWasInstalled = controllerInstalled;
+  }
+
+  void rumbleControllerUI(void *controllerUIObject)
+  {
+    controllerUI *UI = (controllerUI*)controllerUIObject;
+
+    //Wait until the controller is ready for another write
+    if(!UI->parentDevice->installed() || vex::timer::system() - UI->lastWriteTime < CONTROLLER_UI_WRITE_TIME)
     {
-      if(exitIfUpdating)
+      return;
+    }
+
+    if(UI->sendRumble())
+    {
+      UI->lastWriteTime = vex::timer::system();
+    }
+  }
+
+  void controllerUI::renderLines()
+  {
+    dataLock.lock();
+
+    for(uint8_t row = 0; row < CONTROLLER_UI_ROWS; row++)
+    {
+      //ID of the line on this row
+      size_t lineID = currentLine + row;
+
+      //Amount of characters of text on the row
+      int length = 0;
+
+      //*Write the label and data into the row
+      if(lineID < displayLines.size() && displayLines[lineID].isUsed())
       {
-        //Return
-        return evError::Object_State_Is_Changing;
+        UIDataReturn screenData = displayLines[lineID].getData();
+
+        if(screenData.errorData == evError::No_Error)
+        {
+          length = snprintf(targetText[row], CONTROLLER_UI_COLUMNS+1, "%s%s", screenData.label, screenData.data);
+        }
+
+        else
+        {
+          length = snprintf(targetText[row], CONTROLLER_UI_COLUMNS+1, "%s", screenData.label);
+        }
+
+        //Limit the length to the part that fit in the row
+        if(length < 0)
+        {
+          length = 0;
+        }
+
+        else if(length > CONTROLLER_UI_COLUMNS)
+        {
+          length = CONTROLLER_UI_COLUMNS;
+        }
       }
 
-      else
+      //*Clear the remainder of the row
+      memset(targetText[row] + length, ' ', CONTROLLER_UI_COLUMNS - length);
+      targetText[row][CONTROLLER_UI_COLUMNS] = '\0';
+    }
+
+    dataLock.unlock();
+  }
+
+  bool controllerUI::writeRow(uint8_t row)
+  {
+    //*Find the first and last characters that are different
+    int firstChange = -1;
+    int lastChange = -1;
+
+    for(int i = 0; i < CONTROLLER_UI_COLUMNS; i++)
+    {
+      if(shownText[row][i] != targetText[row][i])
       {
-        //Wait until the screen stops updating
-        while(updatingScreen)
+        if(firstChange == -1)
         {
-          vex::this_thread::sleep_for(10);
+          firstChange = i;
         }
+
+        lastChange = i;
       }
     }
 
-    //Store the fact that the screen is updating
-    updatingScreen = true;
+    //Exit if the row hasn't changed
+    if(firstChange == -1)
+    {
+      return false;
+    }
+
+    //*Send everything between the changes as one print
+    char span[CONTROLLER_UI_COLUMNS+1];
+    int spanLength = lastChange - firstChange + 1;
+
+    memcpy(span, targetText[row] + firstChange, spanLength);
+    span[spanLength] = '\0';
+
+    parentController->setCursor(row + 1, firstChange + 1);
+    parentController->print("%s", span);
+
+    //Store what is now on the screen
+    memcpy(shownText[row] + firstChange, span, spanLength);
+
+    return true;
+  }
 
-    //The current line on the screen
-    uint8_t currentScreenLine = 1;
+  bool controllerUI::sendRumble()
+  {
+    //The pattern is copied out so the lock isn't held while sending
+    char rumblePattern[CONTROLLER_UI_RUMBLE_LENGTH+1];
 
-    //The amount of lines to draw
-    uint8_t lineDrawCount = 3;
+    rumbleLock.lock();
+    strcpy(rumblePattern, pendingRumble);
+    pendingRumble[0] = '\0';
+    rumbleLock.unlock();
 
-    //Set the amount of lines to draw if there are less than three data points
-    if(displayLines.size() < 3)
+    if(rumblePattern[0] == '\0')
     {
-      lineDrawCount = displayLines.size();
+      return false;
     }
 
-    //*Update the data on the screen
-    for(size_t i = currentLine; i < (currentLine + lineDrawCount); i++)
+    parentDevice->rumble(rumblePattern);
+    return true;
+  }
+
+  bool controllerUI::writeNextChange()
+  {
+    //*Send rumbles first
+    if(sendRumble())
     {
-      //Only draw data if there is data to draw.
-      if(displayLines[i] != nullptr)
+      return true;
+    }
+
+    //*Send the critical line if it is on the screen
+    if(criticalLine >= (int)currentLine && criticalLine < (int)(currentLine + CONTROLLER_UI_ROWS))
+    {
+      if(writeRow(criticalLine - currentLine))
       {
-        //Get the data for the row
-        UIDataReturn screenData = displayLines[i]->getData();
+        return true;
+      }
+    }
 
-        //*Draw the new data if it has changed
-        if(screenData.hasChanged)
-        {
-          //Set the cursor to tbe point where the data starts
-          parentController->setCursor(currentScreenLine, screenData.label.length()+1);
-
-          //Print the new data in place of the old data
-          parentController->print(screenData.data.c_str());
-
-          //*Clear the remainder of the row
-          for(size_t ii = parentController->column(); ii <= 19; ii++)
-          {
-            parentController->setCursor(currentScreenLine, ii);
-            parentController->print(" ");
-          }
-        }
+    //*Send the other rows in turn so one busy row can't block the others
+    for(uint8_t i = 0; i < CONTROLLER_UI_ROWS; i++)
+    {
+      uint8_t row = (nextRow + i) % CONTROLLER_UI_ROWS;
+
+      if(writeRow(row))
+      {
+        nextRow = (row + 1) % CONTROLLER_UI_ROWS;
+        return true;
       }
-      
-      //Increment the line being drawn on the screen
-      currentScreenLine++;
     }
 
-    //The screen is no longer updating
-    updatingScreen = false;
-    
-    return evError::No_Error;
+    return false;
   }
 
-  evError controllerUI::updateScreen(bool exitIfUpdating)
+  evError controllerUI::updateScreenData(bool exitIfUpdating)
   {
     //Return if there is no data to display
     if(displayLines.size() == 0 || displayLines.max_size() == 0)
@@ -107,7 +209,7 @@ namespace evAPI
       return evError::No_Data_Defined;
     }
 
-    //Decide what to do if the screen is bing updated
+    //Decide what to do if the screen is being updated
     if(updatingScreen)
     {
       if(exitIfUpdating)
@@ -129,53 +231,32 @@ namespace evAPI
     //Store the fact that the screen is updating
     updatingScreen = true;
 
-    //Clear the screen
-    parentController->clearScreen();
-
-    //The current line on the screen
-    uint8_t currentScreenLine = 1;
-
-    //The amount of lines to draw
-    uint8_t lineDrawCount = 3;
-
-    //Set the amount of lines to draw if there are less than three data points
-    if(displayLines.size() < 3)
-    {
-      lineDrawCount = displayLines.size();
-    }
+    //Get the text that should be on the screen
+    renderLines();
 
-    //*Draw the new data to the screen.
-    for(size_t i = currentLine; i < (currentLine + lineDrawCount); i++)
+    //*Send one write if the controller is ready for it
+    if(vex::timer::system() - lastWriteTime >= CONTROLLER_UI_WRITE_TIME)
     {
-      //Only draw data if there is data to draw.
-      if(displayLines[i] != nullptr)
+      if(writeNextChange())
       {
-        //Set the cursor
-        parentController->setCursor(currentScreenLine, 1);
-
-        //Get the data for the row
-        UIDataReturn screenData = displayLines[i]->getData();
-
-        //Print the name
-        parentController->print(screenData.label.c_str());
-
-        //Print the data if applicable
-        if(screenData.errorData == evError::No_Error)
-        {
-          parentController->print(screenData.data.c_str());
-        }
+        lastWriteTime = vex::timer::system();
       }
-
-      //Increment the line being drawn on the screen
-      currentScreenLine++;
     }
 
     //The screen is no longer updating
     updatingScreen = false;
-
+    
     return evError::No_Error;
   }
 
+  evError controllerUI::updateScreen(bool exitIfUpdating)
+  {
+    //Mark the whole screen as unknown so every row is rewritten
+    memset(shownText, 0, sizeof(shownText));
+
+    return updateScreenData(exitIfUpdating);
+  }
+
   evError controllerUI::scrollDown()
   {
     //Return if there is no data to display
@@ -285,6 +366,44 @@ namespace evAPI
     return returnData;
   }
 
+  evError controllerUI::setCriticalLine(int id)
+  {
+    //Exit if the line doesn't exist
+    if(id < -1 || id >= (int)displayLines.size())
+    {
+      return evError::Index_Out_Of_Range;
+    }
+
+    criticalLine = id;
+
+    return evError::No_Error;
+  }
+
+  evError controllerUI::rumble(const char *pattern)
+  {
+    //Make sure the pattern is valid
+    if(pattern == nullptr || pattern[0] == '\0' || strlen(pattern) > CONTROLLER_UI_RUMBLE_LENGTH)
+    {
+      return evError::Invalid_Argument_Data;
+    }
+
+    rumbleLock.lock();
+    strcpy(pendingRumble, pattern);
+    rumbleLock.unlock();
+
+    return evError::No_Error;
+  }
+
+  void controllerUI::lockData()
+  {
+    dataLock.lock();
+  }
+
+  void controllerUI::unlockData()
+  {
+    dataLock.unlock();
+  }
+
   evError controllerUI::addData(uint id, const char name[20])
   {
     //Return if the name data is invalid.
@@ -293,17 +412,18 @@ namespace evAPI
       return evError::Invalid_Argument_Data;
     }
 
+    dataLock.lock();
+
     //Make sure the vector has size for the new data point.
     if(displayLines.size() < id+1)
     {
       displayLines.resize(id+1);
     }
 
-    //Create the new data point.
-    displayLines[id] = new UIData;
-
     //Set the parameters for the data point.
-    displayLines[id]->setData<int8_t>(name, nullptr);
+    displayLines[id].setText(name);
+
+    dataLock.unlock();
 
     return evError::No_Error;
   }
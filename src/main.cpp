@@ -26,6 +26,8 @@
 #define TRIPORT_PORT 22
 #define BACKLATCH A
 
+#define DRIVE_RECORDING_FILE "drive.rec"
+
 // Select namespaces ------------------------------------------------------
 // using namespace vex;
 // using namespace evAPI;
@@ -34,6 +36,9 @@
 evAPI::Drive driveBase = evAPI::Drive(evAPI::blueGearBox);
 evAPI::DriverBaseControl driveControl = evAPI::DriverBaseControl(&primaryController, evAPI::RCControl, &driveBase);
 evAPI::vexUI UI;
+evAPI::ConfigStore tuningConfig;
+evAPI::PIDTuner pidTuner = evAPI::PIDTuner(driveBase);
+evAPI::DriverRecorder driveRecorder = evAPI::DriverRecorder(&driveBase);
 
 // Setup vex component objects (motors, sensors, etc.) --------------------
 auto leftEncoder = vex::rotation(PORT(LEFT_ENCODER_PORT));
@@ -56,18 +61,29 @@ enum autoOptions {
   AUTO_DO_NOTHING = 0,
   AUTO_RIGHT,
   AUTO_LEFT,
+  AUTO_REPLAY,
 };
 
 //Variables to display on the controller
 uint32_t batteryLevel = Brain.Battery.capacity();
-int speed = 0;
+double speed = 0;
 std::string selectedAutoName = "";
+std::string baseStatus = "";
+bool baseWarningShown = false;
+double odoLoopTime = 0;
+double driverLoopTime = 0;
+uint32_t loopOverruns = 0;
+double inputLatency = 0;
+
+//Task manager ID of the autonomous thread
+int autoTaskID = -1;
 
 //Setup controller UI IDs
 enum controllerOptions
 {
   //Match Screen
   MATCH_SCREEN = 0,
+  BASE_STATUS_TEXT,
 
   //Disabled / Auto Screen
   DISABLED_AUTO_SCREEN = 3,
@@ -76,7 +92,16 @@ enum controllerOptions
 
   //Inertial Calibration Screen
   INERTIAL_CALIBRATE_SCREEN = 6,
-  INERTIAL_CALIBRATING_TEXT
+  INERTIAL_CALIBRATING_TEXT,
+
+  //PID Tuning Screen (Secondary Controller)
+  PID_TUNING_SCREEN = 9,
+
+  //Loop Timing Screen (Secondary Controller)
+  LOOP_TIMING_SCREEN = 12,
+  DRIVER_TIMING_TEXT,
+  OVERRUNS_TEXT,
+  INPUT_LATENCY_TEXT
 };
 
 /*---------------------------------------------------------------------------------*/
@@ -88,21 +113,25 @@ void pre_auton(void) {
   UI.autoSelectorUI.addButton(AUTO_DO_NOTHING, vex::red);
   UI.autoSelectorUI.addButton(AUTO_RIGHT, vex::green);
   UI.autoSelectorUI.addButton(AUTO_LEFT, vex::blue);
+  UI.autoSelectorUI.addButton(AUTO_REPLAY, vex::purple);
 
   // Set all the titles
   UI.autoSelectorUI.setButtonTitle(AUTO_DO_NOTHING, "DO NOTHING!");
   UI.autoSelectorUI.setButtonTitle(AUTO_RIGHT, "Right Side Auton");
   UI.autoSelectorUI.setButtonTitle(AUTO_LEFT, "Left Side Auton");
+  UI.autoSelectorUI.setButtonTitle(AUTO_REPLAY, "Replay Driving");
 
   // Set all the descriptions
   UI.autoSelectorUI.setButtonDescription(AUTO_DO_NOTHING, "The robot will do nothing.");
   UI.autoSelectorUI.setButtonDescription(AUTO_RIGHT, "Right Side Auton");
   UI.autoSelectorUI.setButtonDescription(AUTO_LEFT, "Left Side Auton");
+  UI.autoSelectorUI.setButtonDescription(AUTO_REPLAY, "Replays the driving recorded with the Y button.");
 
   // Select all the icons
   UI.autoSelectorUI.setButtonIcon(AUTO_DO_NOTHING, UI.autoSelectorUI.icons.exclamationMark);
   UI.autoSelectorUI.setButtonIcon(AUTO_RIGHT, UI.autoSelectorUI.icons.rightArrow);
   UI.autoSelectorUI.setButtonIcon(AUTO_LEFT, UI.autoSelectorUI.icons.leftArrow);
+  UI.autoSelectorUI.setButtonIcon(AUTO_REPLAY, UI.autoSelectorUI.icons.skills);
 
   //Setup parameters for auto selector
   UI.autoSelectorUI.setSelectedButton(AUTO_LEFT);
@@ -110,24 +139,41 @@ void pre_auton(void) {
   UI.autoSelectorUI.setDataDisplayTime(1500);
 
   //*Setup controller UI
+  constexpr evAPI::formatSpec batteryFormat = evAPI::formatSpec(-1, 0, "%");
+
   //Driver Control Screen
-  UI.primaryControllerUI.addData(MATCH_SCREEN, "Battery: ", batteryLevel);
-  UI.primaryControllerUI.addData(MATCH_SCREEN, "Speed : ", speed);
+  UI.primaryControllerUI.addData(MATCH_SCREEN, "Battery: ", batteryLevel, batteryFormat);
+  UI.primaryControllerUI.addData(MATCH_SCREEN, "Speed : ", speed, evAPI::formatSpec(1, 0, "in/s"));
+  UI.primaryControllerUI.addData(BASE_STATUS_TEXT, "Base: ", baseStatus);
 
   //Disabled Screen
-  UI.primaryControllerUI.addData(DISABLED_AUTO_SCREEN, "Battery: ", batteryLevel);
+  UI.primaryControllerUI.addData(DISABLED_AUTO_SCREEN, "Battery: ", batteryLevel, batteryFormat);
   UI.primaryControllerUI.addData(AUTO_MODE_LABEL, "Selected Auto:");
   UI.primaryControllerUI.addData(AUTO_MODE_TEXT, "", selectedAutoName);
 
   //Calibrating Inertial Screen
-  UI.primaryControllerUI.addData(INERTIAL_CALIBRATE_SCREEN, "Battery: ", batteryLevel);
+  UI.primaryControllerUI.addData(INERTIAL_CALIBRATE_SCREEN, "Battery: ", batteryLevel, batteryFormat);
   UI.primaryControllerUI.addData(INERTIAL_CALIBRATING_TEXT, "Calibrating...");
 
+  //Show auto changes right away
+  UI.primaryControllerUI.setCriticalLine(AUTO_MODE_TEXT);
+
   //*Secondary Controller 
-  UI.secondaryControllerUI.addData(0, "Battery: ", batteryLevel);
+  UI.secondaryControllerUI.addData(0, "Battery: ", batteryLevel, batteryFormat);
+  pidTuner.attach(UI.secondaryControllerUI, PID_TUNING_SCREEN, vex::controllerType::partner);
+  pidTuner.setConfig(tuningConfig);
+  pidTuner.setDriverControl(driveControl);
+
+  //Loop Timing Screen
+  constexpr evAPI::formatSpec timingFormat = evAPI::formatSpec(2, 0, "ms");
+  UI.secondaryControllerUI.addData(LOOP_TIMING_SCREEN, "Odo p99: ", odoLoopTime, timingFormat);
+  UI.secondaryControllerUI.addData(DRIVER_TIMING_TEXT, "Drive p99: ", driverLoopTime, timingFormat);
+  UI.secondaryControllerUI.addData(OVERRUNS_TEXT, "Overruns: ", loopOverruns);
+  UI.secondaryControllerUI.addData(INPUT_LATENCY_TEXT, "Input: ", inputLatency, timingFormat);
 
   //Start the threads
   UI.startThreads();
+  evAPI::taskManager.startMonitor();
 
   //* Setup for smart drive ==================================================
   driveBase.setDebugState(true);
@@ -151,6 +197,9 @@ void pre_auton(void) {
   //Set stopping mode
   driveBase.setStoppingMode(vex::brake);
 
+  // Watch the base motor temperatures and limit them before they overheat
+  driveBase.startHealthMonitor();
+
   // Setup PID
   // driveBase.setupDrivePID(0.125, 10, 0.005, 12, 2, 125);
   driveBase.setupDrivePID(0.125, 4, 0.05, 12, 2, 125);
@@ -163,11 +212,38 @@ void pre_auton(void) {
   //* Setup for base driver contorl ==========================================
   driveControl.setPrimaryStick(evAPI::leftStick);
   driveControl.setHandicaps(1, 0.6);  // main drive, turning
+  driveControl.setDriveShaping(5, evAPI::inputCurve::Cubic, 0.5);  // deadband, curve, amount of curve
+  driveControl.setTurnShaping(5, evAPI::inputCurve::Cubic, 0.5);
+  driveControl.setSlewRate(500);  // max power change of each side per second
+
+  //* Load tuning values from the SD card ====================================
+  // Values in the file replace the ones set above. Anything missing from the file keeps the value above.
+  evAPI::evError tuningError = tuningConfig.load("tuning.ini");
+  driveBase.useConfig(tuningConfig);
+  driveControl.useConfig(tuningConfig);
+
+  // Drive the base from its own thread as soon as the controller sends new stick positions
+  driveControl.startThread();
+
+  // Sample the buttons as soon as they change, so short presses reach the button manager
+  evAPI::buttonManager.startEvents();
+
+  // Record the driving so it can be replayed in autonomous
+  driveControl.setRecorder(&driveRecorder);
+  driveRecorder.load(DRIVE_RECORDING_FILE);
+
+  // Write out a full file to edit if there isn't one yet. A file that is too large is left alone.
+  if(tuningError == evAPI::evError::Object_Does_Not_Exist) tuningConfig.save();
+
+  // Show the PID tuning page on the secondary controller during practice
+  if(!evAPI::isConnectToField()) UI.secondaryControllerUI.setScreenLine(PID_TUNING_SCREEN);
 
   //* Setup controller callbacks =============================================
   // Example:
   // primaryController.LEFT_WINGS_BUTTON.pressed(toggleLeftWing);
-  primaryController.ButtonR1.pressed([](){
+  // The mechanism buttons go through the button manager so a recording can press them during a replay.
+  evAPI::buttonManager.subscribe(vex::controllerType::primary, evAPI::controllerButtons::R1, evAPI::buttonStatus::Pressed,
+                                 [](vex::controllerType, evAPI::controllerButtons, evAPI::buttonStatus, void *){
     if (intakeMotorSpinning) {
       intakeMotor.stop();
       intakeMotorSpinning = false;
@@ -178,7 +254,8 @@ void pre_auton(void) {
     }
   });
 
-  primaryController.ButtonR2.pressed([](){
+  evAPI::buttonManager.subscribe(vex::controllerType::primary, evAPI::controllerButtons::R2, evAPI::buttonStatus::Pressed,
+                                 [](vex::controllerType, evAPI::controllerButtons, evAPI::buttonStatus, void *){
     if (intakeMotorSpinning) {
       intakeMotor.stop();
       intakeMotorSpinning = false;
@@ -189,10 +266,58 @@ void pre_auton(void) {
     }
   });
 
-  primaryController.ButtonL1.pressed([](){
+  // Hold L2 to run the intake without the color sensor slowing it down
+  evAPI::buttonManager.subscribe(vex::controllerType::primary, evAPI::controllerButtons::L2, evAPI::buttonStatus::Pressed,
+                                 [](vex::controllerType, evAPI::controllerButtons, evAPI::buttonStatus, void *){
+    intakeMotorOverride = true;
+    intakeMotor.spin(vex::directionType::fwd, 100, vex::pct);
+  });
+
+  evAPI::buttonManager.subscribe(vex::controllerType::primary, evAPI::controllerButtons::L2, evAPI::buttonStatus::Released,
+                                 [](vex::controllerType, evAPI::controllerButtons, evAPI::buttonStatus, void *){
+    if (!intakeMotorSpinning) {
+      intakeMotor.stop();
+    }
+    intakeMotorOverride = false;
+  });
+
+  evAPI::buttonManager.subscribe(vex::controllerType::primary, evAPI::controllerButtons::L1, evAPI::buttonStatus::Pressed,
+                                 [](vex::controllerType, evAPI::controllerButtons, evAPI::buttonStatus, void *){
     backLatch.set(!backLatch.value());
   });
 
+  // Start and stop recording the driving. Disabled on the field so it can't be hit during a match.
+  primaryController.ButtonY.pressed([](){
+    if(evAPI::isConnectToField()) return;
+
+    if(!driveRecorder.isRecording()) {
+      if(driveRecorder.startRecording() == evAPI::evError::No_Error) {
+        UI.primaryControllerUI.rumble(".");
+      } else {
+        UI.primaryControllerUI.rumble("-");
+      }
+    } else if(driveRecorder.stopRecording(DRIVE_RECORDING_FILE) == evAPI::evError::No_Error) {
+      UI.primaryControllerUI.rumble("..");
+    } else {
+      UI.primaryControllerUI.rumble("-");
+    }
+  });
+
+  // Reload the tuning values from the SD card. Disabled on the field so it can't be hit during a match.
+  primaryController.ButtonX.pressed([](){
+    if(evAPI::isConnectToField()) return;
+
+    if(tuningConfig.reload() == evAPI::evError::No_Error) {
+      UI.primaryControllerUI.rumble(".");
+    } else {
+      UI.primaryControllerUI.rumble("-");
+    }
+
+    // Show how much of the CPU each thread is using and how long each loop takes
+    evAPI::taskManager.printUsage();
+    evAPI::LoopProfiler::printAll();
+  });
+
   //*Display calibrating and autonomous information if connected to a field or comp switch
   if(evAPI::isConnectToField()) UI.primaryControllerUI.setScreenLine(INERTIAL_CALIBRATE_SCREEN);
 
@@ -236,6 +361,11 @@ void autonomous(void) {
   //Times how long auto takes
   vex::timer autoTimer;
 
+  //Run the auto at the Motion priority. The entry from the last auto is left behind if its thread was stopped.
+  evAPI::taskManager.removeTask(autoTaskID);
+  autoTaskID = evAPI::taskManager.addCurrentTask(evAPI::taskRole::Motion, "Autonomous");
+  evAPI::taskManager.beginWork(autoTaskID);
+
   switch (UI.autoSelectorUI.getSelectedButton()) {
     case AUTO_RIGHT:
       driveBase.driveBackward(14.5, 50);
@@ -310,6 +440,11 @@ void autonomous(void) {
       vex::this_thread::sleep_for(500);
       break;
     }
+    //*Drive the same way the driver did when the recording was made
+    case AUTO_REPLAY:
+      driveRecorder.replay();
+      break;
+
     //*Do nothing auto
     case AUTO_DO_NOTHING:
       //!DO NOTHING HERE
@@ -318,12 +453,16 @@ void autonomous(void) {
     //*Default auto that runs if an unknown ID is selected
     default:
       printf("Invalid Auto Selected.\n");
-      primaryController.rumble("---");
+      UI.primaryControllerUI.rumble("---");
       break;
   }
 
   //Print out how long the auto took
   printf("Auto Time: %f\n", autoTimer.value());
+
+  evAPI::taskManager.endWork(autoTaskID);
+  evAPI::taskManager.removeTask(autoTaskID);
+  autoTaskID = -1;
 }
 
 /*---------------------------------------------------------------------------------*/
@@ -334,41 +473,32 @@ double changeToDistance(double change, double radius) {
   return (change * (radius * M_PI)) / (2 * M_PI);
 }
 
+// Slows the intake down for a moment when the color sensor sees a ring, unless L2 or R2 is overriding it
+void checkIntakeColor() {
+  vex::color detectedColor = intakeSensor.color();
+  if (!intakeMotorOverride && (detectedColor == vex::color::red || detectedColor == vex::color::blue)) {
+    vex::thread([]() {
+      printf("detect\n");
+      intakeMotor.setVelocity(40, vex::percentUnits::pct);
+      vex::this_thread::sleep_for(1500);
+      intakeMotor.setVelocity(100, vex::percentUnits::pct);
+    }).detach();
+  }
+}
+
 void usercontrol(void) {
+  // A replay that ran to the end of autonomous had its thread stopped before it could clean up
+  driveRecorder.stopReplay();
+
   UI.primaryControllerUI.setScreenLine(MATCH_SCREEN);
-  bool l2intake = false;
   while (1) {
     //=========== All drivercontrol code goes between the lines ==============
 
     //* Control the base code -----------------------------
-    driveControl.driverLoop();
+    // The base is driven by the driver control thread. The PID tuner pauses it while it runs a test motion.
 
-    if (primaryController.ButtonL2.pressing()) {
-      intakeMotorOverride = true;
-      intakeMotor.spin(vex::directionType::fwd, 100, vex::pct);
-      l2intake = true;
-    } else {
-      if (!intakeMotorSpinning) {
-        intakeMotor.stop();
-      }
-      if (l2intake == true) {
-        l2intake = false;
-        intakeMotorOverride = false;
-      }
-      
-    }
-    
-    vex::color detectedColor = intakeSensor.color();
-    if (!intakeMotorOverride && (detectedColor == vex::color::red || detectedColor == vex::color::blue)) {
-      vex::thread([]() {
-        printf("detect\n");
-        intakeMotor.setVelocity(40, vex::percentUnits::pct);
-        vex::this_thread::sleep_for(1500);
-        intakeMotor.setVelocity(100, vex::percentUnits::pct);
-      }).detach();
-    }
-    
-    
+    // The intake buttons are handled by the button manager
+    checkIntakeColor();
 
     //========================================================================
     //* Control the intake code ---------------------------
@@ -390,12 +520,46 @@ int main() {
 
   // Prevent main from exiting with an infinite loop.
   while (true) {
+    //*Read the controller buttons once for everything that checks them this loop
+    evAPI::buttonManager.update();
+
+    //*usercontrol doesn't run during a replay, so the intake color check runs here instead
+    if(driveRecorder.isReplaying()) checkIntakeColor();
+
     //*Update controller UI data
     batteryLevel = Brain.Battery.capacity();
     speed = (driveBase.getMotorSpeed(vex::left) + driveBase.getMotorSpeed(vex::right)) / 2;
 
-    //Update auto name
+    //Update the base motor status
+    evAPI::MotorHealthMonitor &baseHealth = driveBase.getHealthMonitor();
+    char statusText[20];
+    if(baseHealth.getCurrentLimit() < MOTOR_MAX_CURRENT) {
+      snprintf(statusText, sizeof(statusText), "%.0fC LIM %.1fA", baseHealth.getMaxTemperature(), baseHealth.getCurrentLimit());
+    } else if(baseHealth.hasWarning()) {
+      snprintf(statusText, sizeof(statusText), "%.0fC HOT %.0fs", baseHealth.getMaxTemperature(), baseHealth.getTimeToThrottle());
+    } else {
+      snprintf(statusText, sizeof(statusText), "%.0fC OK", baseHealth.getMaxTemperature());
+    }
+
+    //The UI thread reads the strings, so they are only changed while it is locked out
+    UI.primaryControllerUI.lockData();
+    baseStatus = statusText;
     selectedAutoName = UI.autoSelectorUI.getSelectedButtonTitle();
+    UI.primaryControllerUI.unlockData();
+
+    // Rumble once when the base starts getting hot
+    if(baseHealth.hasWarning() && !baseWarningShown) UI.primaryControllerUI.rumble("--");
+    baseWarningShown = baseHealth.hasWarning();
+
+    //Update the PID tuning page
+    pidTuner.update();
+
+    //Update the loop timing page
+    odoLoopTime = driveBase.getOdoProfiler().getPercentile(evAPI::loopMetric::Execution, 99);
+    driverLoopTime = driveControl.getProfiler().getPercentile(evAPI::loopMetric::Execution, 99);
+    loopOverruns = driveBase.getOdoProfiler().getOverruns() + driveBase.getMotionProfiler().getOverruns() +
+                   driveControl.getProfiler().getOverruns();
+    inputLatency = driveControl.getInputLatency();
 
     vex::task::sleep(20);
   }